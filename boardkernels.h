@@ -0,0 +1,324 @@
+#ifndef BOARDKERNELS_H
+#define BOARDKERNELS_H
+
+#include <cstdint>
+#include "heuristictables.h"
+#include "puzzleboard.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BOARDKERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+/*********************************************************************
+ *
+ * BOARDKERNELS
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct KernelTable: compile-time square and goal vectors of a puzzle
+ *   enum class SimdLevel: vector instruction sets the kernels can use
+ *   simdLevel: best instruction set of the running processor
+ *   misplacedTiles: Misplaced Tile cost of a byte board
+ *   manhattanDistance: Manhattan Distance of a byte board
+ *
+ * The kernels evaluate a whole board stored one byte per square, as
+ * the ByteBoards of 5x5 to 7x7 puzzles are, with SSE2 or AVX2 vector
+ * instructions. The instruction set is chosen at runtime from the
+ * running processor, and every kernel also has a scalar version,
+ * used on other processors and compilers. The vector kernels read the
+ * board in place and never past its last square, so they need boards
+ * of at least 16 squares; smaller boards are packed into 64 bits and
+ * evaluated without them.
+ *********************************************************************/
+
+/*********************************************************************
+ * KernelTable (struct)
+ *   Holds, for every square of a Rows x Cols puzzle, the number that
+ *   belongs on it in the goal and its row and column as 16-bit lanes.
+ *   The goal row of number t is computed in the vector lanes as
+ *   ((t - 1) * ROW_FACTOR) >> 8 and its goal column by subtracting
+ *   Cols times the row, since byte shuffles can only look up 16
+ *   entries and boards have up to 49 numbers.
+ *********************************************************************/
+template <int Rows, int Cols>
+struct KernelTable
+{
+  static constexpr int LEN = Rows * Cols;                          // number of squares
+  static constexpr uint16_t ROW_FACTOR = (256 + Cols - 1) / Cols;  // divides by Cols
+
+  alignas(32) uint8_t goal[LEN];   // number on each square in the goal
+  alignas(32) int16_t row[LEN];    // row of each square
+  alignas(32) int16_t col[LEN];    // column of each square
+
+  constexpr KernelTable() : goal(), row(), col()
+  {
+    for (int i = 0; i < LEN; ++i)
+    {
+      goal[i] = i < LEN - 1 ? i + 1 : 0;
+      row[i] = i / Cols;
+      col[i] = i % Cols;
+    }
+  }
+
+  // Returns true if ROW_FACTOR gives the goal row of every number
+  static constexpr bool rowFactorIsExact()
+  {
+    for (int t = 1; t < LEN; ++t)
+    {
+      if (((t - 1) * ROW_FACTOR) >> 8 != (t - 1) / Cols)
+        return false;
+    }
+    return true;
+  }
+};
+
+// Compile-time kernel table of a Rows x Cols puzzle
+template <int Rows, int Cols>
+inline constexpr KernelTable<Rows, Cols> KERNEL_TABLE{};
+
+// Vector instruction sets the kernels can use, from least to most capable
+enum class SimdLevel { SCALAR, SSE2, AVX2 };
+
+// Returns the best instruction set of the running processor, detected once
+inline SimdLevel simdLevel()
+{
+  static const SimdLevel level = []
+  {
+#if defined(BOARDKERNELS_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+      return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+      return SimdLevel::SSE2;
+#endif
+    return SimdLevel::SCALAR;
+  }();
+  return level;
+}
+
+// Counts the tiles of a byte board that are not on their goal squares, one
+// square at a time
+template <int Rows, int Cols>
+int misplacedTilesScalar(const uint8_t* squares)
+{
+  int cost = 0;
+
+  for (int i = 0; i < Rows * Cols; ++i)
+  {
+    if (squares[i] != 0 && squares[i] != i + 1)
+      cost++;
+  }
+
+  return cost;
+}
+
+// Sums the Manhattan distances of the tiles of a byte board, one square at a time
+template <int Rows, int Cols>
+int manhattanDistanceScalar(const uint8_t* squares)
+{
+  const ManhattanTable<Rows, Cols>& manhattan = MANHATTAN<Rows, Cols>;
+  int cost = 0;
+
+  for (int i = 0; i < Rows * Cols; ++i)
+  {
+    if (squares[i] != 0)
+      cost += manhattan.dist[squares[i]][i];
+  }
+
+  return cost;
+}
+
+#if defined(BOARDKERNELS_X86)
+
+// Returns a bit for each of the 16 squares from square i that holds a misplaced
+// tile: neither the blank nor the goal number
+template <int Rows, int Cols>
+__attribute__((target("sse2"))) unsigned misplacedMask16(const uint8_t* squares, int i)
+{
+  __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(squares + i));
+  __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(KERNEL_TABLE<Rows, Cols>.goal + i));
+  unsigned blanks = _mm_movemask_epi8(_mm_cmpeq_epi8(t, _mm_setzero_si128()));
+  unsigned placed = _mm_movemask_epi8(_mm_cmpeq_epi8(t, g));
+  return ~(blanks | placed) & 0xFFFF;
+}
+
+// Returns the Manhattan distances of the tiles on the 8 squares from square i in
+// 16-bit lanes, 0 for the blank: the goal row and column of each tile are computed
+// by multiplying and shifting, and subtracted from the square's
+template <int Rows, int Cols>
+__attribute__((target("sse2"))) __m128i manhattanLanes8(const uint8_t* squares, int i)
+{
+  using Table = KernelTable<Rows, Cols>;
+  const Table& table = KERNEL_TABLE<Rows, Cols>;
+  const __m128i zero = _mm_setzero_si128();
+
+  __m128i t = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(squares + i)), zero);
+  __m128i index = _mm_sub_epi16(t, _mm_set1_epi16(1));
+  __m128i goalRow = _mm_mulhi_epu16(index, _mm_set1_epi16(int16_t(Table::ROW_FACTOR << 8)));
+  __m128i goalCol = _mm_sub_epi16(index, _mm_mullo_epi16(goalRow, _mm_set1_epi16(Cols)));
+  __m128i rowDiff = _mm_sub_epi16(goalRow, _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.row + i)));
+  __m128i colDiff = _mm_sub_epi16(goalCol, _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.col + i)));
+  __m128i dist = _mm_add_epi16(_mm_max_epi16(rowDiff, _mm_sub_epi16(zero, rowDiff)),
+                               _mm_max_epi16(colDiff, _mm_sub_epi16(zero, colDiff)));
+  return _mm_andnot_si128(_mm_cmpeq_epi16(t, zero), dist);
+}
+
+// Returns the Manhattan distances of the tiles on the 8 squares ending at the last
+// square, keeping only the lanes of squares from square done on
+template <int Rows, int Cols>
+__attribute__((target("sse2"))) __m128i manhattanTail8(const uint8_t* squares, int done)
+{
+  constexpr int LEN = Rows * Cols;
+  __m128i lanes = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  __m128i keep = _mm_cmpgt_epi16(lanes, _mm_set1_epi16(int16_t(done - (LEN - 8) - 1)));
+  return _mm_and_si128(keep, manhattanLanes8<Rows, Cols>(squares, LEN - 8));
+}
+
+// Adds up the 16-bit lanes of a vector
+__attribute__((target("sse2"))) inline int sumLanes(__m128i sum)
+{
+  sum = _mm_madd_epi16(sum, _mm_set1_epi16(1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+  return _mm_cvtsi128_si32(sum);
+}
+
+// Counts misplaced tiles 16 squares at a time. The last squares are read by a
+// load ending at the last square, which overlaps the previous one, and the bits
+// of the squares already counted are dropped, so nothing is read past the board
+template <int Rows, int Cols>
+__attribute__((target("sse2"))) int misplacedTilesSse2(const uint8_t* squares)
+{
+  constexpr int LEN = Rows * Cols;
+  static_assert(LEN >= 16, "Vector kernels need boards of at least 16 squares");
+  int cost = 0;
+  int i = 0;
+
+  for (; i + 16 <= LEN; i += 16)
+    cost += __builtin_popcount(misplacedMask16<Rows, Cols>(squares, i));
+  if (i < LEN)
+    cost += __builtin_popcount(misplacedMask16<Rows, Cols>(squares, LEN - 16) >> (16 - (LEN - i)));
+
+  return cost;
+}
+
+// Counts misplaced tiles 32 squares at a time, then as the SSE2 kernel does
+template <int Rows, int Cols>
+__attribute__((target("avx2"))) int misplacedTilesAvx2(const uint8_t* squares)
+{
+  constexpr int LEN = Rows * Cols;
+  static_assert(LEN >= 16, "Vector kernels need boards of at least 16 squares");
+  const KernelTable<Rows, Cols>& table = KERNEL_TABLE<Rows, Cols>;
+  int cost = 0;
+  int i = 0;
+
+  for (; i + 32 <= LEN; i += 32)
+  {
+    __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(squares + i));
+    __m256i g = _mm256_load_si256(reinterpret_cast<const __m256i*>(table.goal + i));
+    unsigned blanks = _mm256_movemask_epi8(_mm256_cmpeq_epi8(t, _mm256_setzero_si256()));
+    unsigned placed = _mm256_movemask_epi8(_mm256_cmpeq_epi8(t, g));
+    cost += __builtin_popcount(~(blanks | placed));
+  }
+  for (; i + 16 <= LEN; i += 16)
+    cost += __builtin_popcount(misplacedMask16<Rows, Cols>(squares, i));
+  if (i < LEN)
+    cost += __builtin_popcount(misplacedMask16<Rows, Cols>(squares, LEN - 16) >> (16 - (LEN - i)));
+
+  return cost;
+}
+
+// Sums Manhattan distances 8 squares at a time in 16-bit lanes, reading the last
+// squares with an overlapping load as the Misplaced Tile kernel does
+template <int Rows, int Cols>
+__attribute__((target("sse2"))) int manhattanDistanceSse2(const uint8_t* squares)
+{
+  constexpr int LEN = Rows * Cols;
+  static_assert(KernelTable<Rows, Cols>::rowFactorIsExact(), "Goal rows must be exact");
+  static_assert(LEN >= 16, "Vector kernels need boards of at least 16 squares");
+  __m128i sum = _mm_setzero_si128();
+  int i = 0;
+
+  for (; i + 8 <= LEN; i += 8)
+    sum = _mm_add_epi16(sum, manhattanLanes8<Rows, Cols>(squares, i));
+  if (i < LEN)
+    sum = _mm_add_epi16(sum, manhattanTail8<Rows, Cols>(squares, i));
+
+  return sumLanes(sum);
+}
+
+// Sums Manhattan distances 16 squares at a time in 16-bit lanes, then as the
+// SSE2 kernel does
+template <int Rows, int Cols>
+__attribute__((target("avx2"))) int manhattanDistanceAvx2(const uint8_t* squares)
+{
+  using Table = KernelTable<Rows, Cols>;
+  constexpr int LEN = Rows * Cols;
+  static_assert(Table::rowFactorIsExact(), "Goal rows must be exact");
+  static_assert(LEN >= 16, "Vector kernels need boards of at least 16 squares");
+  const Table& table = KERNEL_TABLE<Rows, Cols>;
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i wide = zero;
+  int i = 0;
+
+  for (; i + 16 <= LEN; i += 16)
+  {
+    __m256i t = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(squares + i)));
+    __m256i index = _mm256_sub_epi16(t, _mm256_set1_epi16(1));
+    __m256i goalRow = _mm256_mulhi_epu16(index, _mm256_set1_epi16(int16_t(Table::ROW_FACTOR << 8)));
+    __m256i goalCol = _mm256_sub_epi16(index, _mm256_mullo_epi16(goalRow, _mm256_set1_epi16(Cols)));
+    __m256i rowDiff = _mm256_sub_epi16(goalRow, _mm256_load_si256(reinterpret_cast<const __m256i*>(table.row + i)));
+    __m256i colDiff = _mm256_sub_epi16(goalCol, _mm256_load_si256(reinterpret_cast<const __m256i*>(table.col + i)));
+    __m256i dist = _mm256_add_epi16(_mm256_abs_epi16(rowDiff), _mm256_abs_epi16(colDiff));
+    wide = _mm256_add_epi16(wide, _mm256_andnot_si256(_mm256_cmpeq_epi16(t, zero), dist));
+  }
+
+  __m128i sum = _mm_add_epi16(_mm256_castsi256_si128(wide), _mm256_extracti128_si256(wide, 1));
+  for (; i + 8 <= LEN; i += 8)
+    sum = _mm_add_epi16(sum, manhattanLanes8<Rows, Cols>(squares, i));
+  if (i < LEN)
+    sum = _mm_add_epi16(sum, manhattanTail8<Rows, Cols>(squares, i));
+
+  return sumLanes(sum);
+}
+
+#endif // BOARDKERNELS_X86
+
+// Returns the Misplaced Tile cost of a byte board with the best kernel available
+template <int Rows, int Cols>
+int misplacedTiles(const uint8_t* squares)
+{
+#if defined(BOARDKERNELS_X86)
+  switch (simdLevel())
+  {
+    case SimdLevel::AVX2:
+      return misplacedTilesAvx2<Rows, Cols>(squares);
+    case SimdLevel::SSE2:
+      return misplacedTilesSse2<Rows, Cols>(squares);
+    default:
+      break;
+  }
+#endif
+  return misplacedTilesScalar<Rows, Cols>(squares);
+}
+
+// Returns the Manhattan Distance of a byte board with the best kernel available
+template <int Rows, int Cols>
+int manhattanDistance(const uint8_t* squares)
+{
+#if defined(BOARDKERNELS_X86)
+  switch (simdLevel())
+  {
+    case SimdLevel::AVX2:
+      return manhattanDistanceAvx2<Rows, Cols>(squares);
+    case SimdLevel::SSE2:
+      return manhattanDistanceSse2<Rows, Cols>(squares);
+    default:
+      break;
+  }
+#endif
+  return manhattanDistanceScalar<Rows, Cols>(squares);
+}
+
+#endif // BOARDKERNELS_H
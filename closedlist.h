@@ -0,0 +1,100 @@
+#ifndef CLOSEDLIST_H
+#define CLOSEDLIST_H
+
+#include <type_traits>
+#include <vector>
+#include "nodearena.h"
+#include "permutation.h"
+#include "puzzleboard.h"
+#include "statetable.h"
+
+/*********************************************************************
+ *
+ * CLOSEDLIST
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class RankedClosedList: closed list indexed by permutation rank
+ *   class HashedClosedList: closed list stored in an open-addressing table
+ *   ClosedListFor: closed list type used for a puzzle size
+ *********************************************************************/
+
+/*********************************************************************
+ * RankedClosedList Class
+ *   Closed list for puzzles small enough that every state of the
+ *   start's solvability class can be given its own slot. States are
+ *   indexed by boardRank, so a duplicate check is a single array
+ *   access. Each slot holds the arena index of the explored node, or
+ *   NO_NODE; for the 8-puzzle the 181,440 slots take 726 KB.
+ *********************************************************************/
+template <int Len, typename Board>
+class RankedClosedList
+{
+  public:
+    RankedClosedList() : entries(Len * lehmerCount(Len - 3, Len - 1), NO_NODE) {}
+
+    // Returns the node of the given state, or NO_NODE if it is not closed
+    NodeIndex find(const StateKey<Board>& key) const
+    {
+      return entries[boardRank<Len>(key.board)];
+    }
+
+    // Closes the given state with its node
+    void insert(const StateKey<Board>& key, NodeIndex node)
+    {
+      entries[boardRank<Len>(key.board)] = node;
+    }
+
+    // Reopens the given state
+    void erase(const StateKey<Board>& key)
+    {
+      entries[boardRank<Len>(key.board)] = NO_NODE;
+    }
+
+  private:
+    std::vector<NodeIndex> entries;  // node of every state, indexed by rank
+};
+
+/*********************************************************************
+ * HashedClosedList Class
+ *   Closed list for puzzles whose state space is too large to index
+ *   directly, storing the board and node index of each explored state
+ *   in an open-addressing StateTable.
+ *********************************************************************/
+template <typename Board>
+class HashedClosedList
+{
+  public:
+    explicit HashedClosedList(float maxLoadFactor = 0.5f) : entries(maxLoadFactor) {}
+
+    // Returns the node of the given state, or NO_NODE if it is not closed
+    NodeIndex find(const StateKey<Board>& key) const
+    {
+      const NodeIndex* node = entries.find(key);
+      return node == nullptr ? NO_NODE : *node;
+    }
+
+    // Closes the given state with its node
+    void insert(const StateKey<Board>& key, NodeIndex node)
+    {
+      entries.insert(key, node);
+    }
+
+    // Reopens the given state
+    void erase(const StateKey<Board>& key)
+    {
+      entries.erase(key);
+    }
+
+  private:
+    StateTable<Board, NodeIndex> entries;  // node of every explored state
+};
+
+// Closed list used for a puzzle with the given number of squares: rank-indexed
+// up to 9 squares (181,440 states for the 8-puzzle), hashed beyond that
+template <int Len, typename Board>
+using ClosedListFor = typename std::conditional<(Len <= 9),
+                                                RankedClosedList<Len, Board>,
+                                                HashedClosedList<Board>>::type;
+
+#endif // CLOSEDLIST_H
@@ -0,0 +1,104 @@
+#ifndef DISTANCETABLE_H
+#define DISTANCETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "permutation.h"
+#include "puzzleboard.h"
+
+/*********************************************************************
+ *
+ * DISTANCETABLE
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class DistanceTable: exact goal distance of every state of a small
+ *                        puzzle
+ *********************************************************************/
+
+/*********************************************************************
+ * DistanceTable Class
+ *   Holds the number of moves from every solvable state of a Rows x
+ *   Cols puzzle to the goal, one byte per state indexed by boardRank:
+ *   181,440 bytes for the 8-puzzle. The table is filled by a
+ *   breadth-first search backward from the goal, which takes about 50
+ *   milliseconds, the first time it is used in a process. With it, a
+ *   puzzle is solved without searching: some neighbor of every state
+ *   but the goal is one move closer, so following such neighbors
+ *   reaches the goal in as many moves as the state's distance.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   The puzzle must have at most 9 squares.
+ *********************************************************************/
+template <int Rows, int Cols>
+class DistanceTable
+{
+  static_assert(Rows * Cols <= 9, "Distance tables support puzzles of up to 9 squares");
+
+  public:
+    static constexpr int LEN = Rows * Cols;  // number of squares
+    using Board = BoardFor<LEN>;              // board representation
+
+    // Returns the table of this size, building it on first use
+    static const DistanceTable& get()
+    {
+      static const DistanceTable table;
+      return table;
+    }
+
+    // Returns the number of moves from the given solvable state to the goal
+    int distance(const Board& board) const
+    {
+      return distances[boardRank<LEN>(board)];
+    }
+
+    // Returns the number of states in the table
+    size_t size() const { return distances.size(); }
+
+  private:
+    static constexpr uint8_t UNSEEN = 0xFF;  // distance of a state not reached yet
+
+    // Fills the table by a breadth-first search from the goal
+    DistanceTable()
+      : distances(LEN * lehmerCount(LEN - 3, LEN - 1), UNSEEN)
+    {
+      const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+      std::vector<std::pair<Board, int>> queue;  // states in order of distance, with their blank
+      Board goal;
+
+      for (int i = 0; i < LEN - 1; ++i)
+        goal.set(i, i + 1);
+      queue.reserve(distances.size());
+      queue.emplace_back(goal, LEN - 1);
+      distances[boardRank<LEN>(goal)] = 0;
+
+      for (size_t next = 0; next < queue.size(); ++next)
+      {
+        Board board = queue[next].first;
+        int blankIdx = queue[next].second;
+        int cost = distances[boardRank<LEN>(board)] + 1;
+
+        for (int move = 0; move < 4; ++move)
+        {
+          int tileIdx = geo.neighbor[blankIdx][move];
+          if (tileIdx < 0)
+            continue;
+
+          Board child = board;
+          child.slide(tileIdx, blankIdx);
+          uint8_t& entry = distances[boardRank<LEN>(child)];
+          if (entry == UNSEEN)
+          {
+            entry = cost;
+            queue.emplace_back(child, tileIdx);
+          }
+        }
+      }
+    }
+
+    std::vector<uint8_t> distances;  // moves to the goal of every state, by rank
+};
+
+#endif // DISTANCETABLE_H
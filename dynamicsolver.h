@@ -0,0 +1,434 @@
+#ifndef DYNAMICSOLVER_H
+#define DYNAMICSOLVER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "closedlist.h"
+#include "heuristics.h"
+#include "puzzleboard.h"
+#include "puzzlesolver.h"
+
+/*********************************************************************
+ *
+ * DYNAMICSOLVER
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct DynamicGeometry: row, column and neighbor tables of a
+ *                           puzzle whose dimensions are known at
+ *                           runtime
+ *   struct DynamicShape: board and tables of a puzzle whose dimensions
+ *                        are known at runtime
+ *   class DynamicUniformCostHeuristic: Uniform Cost Search
+ *   class DynamicMisplacedTileHeuristic: Misplaced Tile heuristic
+ *   class DynamicEuclideanHeuristic: Euclidean Distance heuristic
+ *   class DynamicManhattanHeuristic: Manhattan Distance heuristic
+ *   class DynamicLinearConflictHeuristic: Manhattan Distance + Linear
+ *                                         Conflict heuristic
+ *   class DynamicPuzzleSolver: solves a sliding puzzle whose
+ *                              dimensions are known at runtime
+ *********************************************************************/
+
+/*********************************************************************
+ * DynamicGeometry (struct)
+ *   Holds the same tables as Geometry for a rows x cols puzzle whose
+ *   dimensions are only known at runtime.
+ *********************************************************************/
+struct DynamicGeometry
+{
+  int rows;                                 // number of rows
+  int cols;                                 // number of columns
+  int len;                                  // number of squares
+  std::vector<int> row;                     // row of each square
+  std::vector<int> col;                     // column of each square
+  std::vector<std::array<int, 4>> neighbor;  // square reached by each move code from
+                                            // each square (-1 if the move is illegal)
+
+  DynamicGeometry(int rows, int cols)
+    : rows(rows), cols(cols), len(rows * cols), row(len), col(len), neighbor(len)
+  {
+    for (int i = 0; i < len; ++i)
+    {
+      row[i] = i / cols;
+      col[i] = i % cols;
+      neighbor[i][0] = row[i] > 0 ? i - cols : -1;
+      neighbor[i][1] = row[i] < rows - 1 ? i + cols : -1;
+      neighbor[i][2] = col[i] > 0 ? i - 1 : -1;
+      neighbor[i][3] = col[i] < cols - 1 ? i + 1 : -1;
+    }
+  }
+
+  // Returns the Manhattan distance of number tile on square idx from its goal square
+  int distance(int tile, int idx) const
+  {
+    return std::abs(row[idx] - row[tile - 1]) + std::abs(col[idx] - col[tile - 1]);
+  }
+};
+
+/*********************************************************************
+ * DynamicShape (struct)
+ *   Describes a rows x cols puzzle whose dimensions are only known at
+ *   runtime to BasicPuzzleSolver, as FixedShape does for compile-time
+ *   dimensions. Boards are stored one byte per square in a ByteBoard
+ *   of Capacity squares, of which the first rows * cols are used, and
+ *   the row, column and neighbor lookups come from a DynamicGeometry.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   Tile numbers are stored in bytes, so Capacity must be at most 256.
+ *********************************************************************/
+template <int Capacity>
+struct DynamicShape
+{
+  static_assert(Capacity <= 256, "tile numbers must fit in a byte");
+
+  using Board = ByteBoard<Capacity>;           // board representation
+  using ClosedList = HashedClosedList<Board>;  // explored states table
+
+  DynamicGeometry geo;  // row, column and neighbor tables of the puzzle
+  static constexpr const ZobristTable<Capacity>& zobrist = ZOBRIST<Capacity>;
+
+  DynamicShape(int rows, int cols) : geo(rows, cols) {}
+
+  int rows() const { return geo.rows; }
+  int cols() const { return geo.cols; }
+  int len() const { return geo.len; }
+};
+
+/*********************************************************************
+ * DynamicUniformCostHeuristic Class
+ *   Estimates every cost as 0, which turns A* into Uniform Cost
+ *   Search.
+ *********************************************************************/
+template <typename Node>
+class DynamicUniformCostHeuristic : public HeuristicTraits
+{
+  public:
+    explicit DynamicUniformCostHeuristic(const DynamicGeometry&) {}
+
+    float initialize(Node&) const { return 0; }
+    float update(const Node&, Node&) const { return 0; }
+    float evaluate(const Node&) const { return 0; }
+};
+
+/*********************************************************************
+ * DynamicMisplacedTileHeuristic Class
+ *   Estimates the cost of a state as the number of tiles that are not
+ *   in their correct positions. A child's cost differs from its
+ *   parent's only by the slid tile.
+ *********************************************************************/
+template <typename Node>
+class DynamicMisplacedTileHeuristic : public HeuristicTraits
+{
+  public:
+    explicit DynamicMisplacedTileHeuristic(const DynamicGeometry& geo) : geo(geo) {}
+
+    float initialize(Node& node) const { return evaluate(node); }
+
+    // The slid tile moves from the child's blank square to the parent's
+    float update(const Node& parent, Node& child) const
+    {
+      int tile = child.tile(parent.blankIdx);
+      return parent.h - (tile != child.blankIdx + 1) + (tile != parent.blankIdx + 1);
+    }
+
+    // Counts the tiles that are not on their goal squares
+    float evaluate(const Node& node) const
+    {
+      int cost = 0;  // Misplaced Tile heuristic cost
+
+      for (int i = 0; i < geo.len; ++i)
+      {
+        int tile = node.tile(i);
+        if (tile != 0 && tile != i + 1)
+          cost++;
+      }
+
+      return cost;
+    }
+
+  private:
+    const DynamicGeometry& geo;
+};
+
+/*********************************************************************
+ * DynamicEuclideanHeuristic Class
+ *   Estimates the cost of a state as the sum of the Euclidean
+ *   distances of the tiles from their correct positions. The costs
+ *   are fractional.
+ *********************************************************************/
+template <typename Node>
+class DynamicEuclideanHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr bool INTEGRAL = false;
+
+    explicit DynamicEuclideanHeuristic(const DynamicGeometry& geo) : geo(geo) {}
+
+    float initialize(Node& node) const { return evaluate(node); }
+    float update(const Node&, Node& child) const { return evaluate(child); }
+
+    // Sums up the Euclidean distance of each tile
+    float evaluate(const Node& node) const
+    {
+      float cost = 0;  // Euclidean Distance heuristic cost
+
+      for (int i = 0; i < geo.len; ++i)
+      {
+        int tile = node.tile(i);
+        if (tile == 0)
+          continue;
+
+        int rowDist = geo.row[i] - geo.row[tile - 1];
+        int colDist = geo.col[i] - geo.col[tile - 1];
+        cost += std::sqrt(double((rowDist * rowDist) + (colDist * colDist)));
+      }
+
+      return cost;
+    }
+
+  private:
+    const DynamicGeometry& geo;
+};
+
+/*********************************************************************
+ * DynamicManhattanHeuristic Class
+ *   Estimates the cost of a state as the sum of the Manhattan
+ *   distances of the tiles from their correct positions. A child's
+ *   cost is its parent's, kept in the baseCost field, adjusted by the
+ *   distance change of the single slid tile.
+ *********************************************************************/
+template <typename Node>
+class DynamicManhattanHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr bool USES_BASE_COST = true;
+
+    explicit DynamicManhattanHeuristic(const DynamicGeometry& geo) : geo(geo) {}
+
+    float initialize(Node& node) const
+    {
+      node.baseCost = evaluate(node);
+      return node.baseCost;
+    }
+
+    float update(const Node& parent, Node& child) const
+    {
+      int tile = child.tile(parent.blankIdx);
+      child.baseCost = parent.baseCost - geo.distance(tile, child.blankIdx)
+                     + geo.distance(tile, parent.blankIdx);
+      return child.baseCost;
+    }
+
+    // Sums up |GoalRow - CurrentRow| + |GoalColumn - CurrentColumn| over the tiles
+    float evaluate(const Node& node) const
+    {
+      int cost = 0;
+
+      for (int i = 0; i < geo.len; ++i)
+      {
+        int tile = node.tile(i);
+        if (tile != 0)
+          cost += geo.distance(tile, i);
+      }
+
+      return cost;
+    }
+
+  private:
+    const DynamicGeometry& geo;
+};
+
+/*********************************************************************
+ * DynamicLinearConflictHeuristic Class
+ *   Estimates the cost of a state as its Manhattan Distance plus 2
+ *   for every tile in the minimum set of tiles that must leave each
+ *   row and column to resolve its linear conflicts, as the
+ *   LinearConflictHeuristic does. A node has too many lines to keep
+ *   their counts, so a child's cost is its parent's adjusted by the
+ *   Manhattan distance change of the slid tile and by the change of
+ *   the two lines it leaves and enters, counted on both boards.
+ *********************************************************************/
+template <typename Node>
+class DynamicLinearConflictHeuristic : public HeuristicTraits
+{
+  public:
+    explicit DynamicLinearConflictHeuristic(const DynamicGeometry& geo)
+      : geo(geo), manhattan(geo), goalPos(std::max(geo.rows, geo.cols)),
+        longest(std::max(geo.rows, geo.cols)) {}
+
+    float initialize(Node& node) const { return evaluate(node); }
+
+    float update(const Node& parent, Node& child) const
+    {
+      int tile = child.tile(parent.blankIdx);
+      int cost = parent.h - geo.distance(tile, child.blankIdx)
+               + geo.distance(tile, parent.blankIdx);
+
+      // Lines the tile leaves and enters: rows are lines 0 to rows - 1 and columns
+      // are lines rows to rows + cols - 1
+      bool vertical = child.move < 2;  // true for UP and DOWN moves
+      int oldLine = vertical ? geo.row[child.blankIdx] : geo.rows + geo.col[child.blankIdx];
+      int newLine = vertical ? geo.row[parent.blankIdx] : geo.rows + geo.col[parent.blankIdx];
+
+      for (int line : {oldLine, newLine})
+        cost += 2 * (lineConflicts(child, line) - lineConflicts(parent, line));
+
+      return cost;
+    }
+
+    // Adds up the Manhattan Distance and the conflicts of every row and column
+    float evaluate(const Node& node) const
+    {
+      int cost = manhattan.evaluate(node);
+
+      for (int line = 0; line < geo.rows + geo.cols; ++line)
+        cost += 2 * lineConflicts(node, line);
+
+      return cost;
+    }
+
+  private:
+    // Counts the tiles that must leave a line: the tiles whose goal line is this
+    // line are listed in order of appearance by their goal position along it, and
+    // the count is their number minus the length of their longest increasing
+    // subsequence
+    int lineConflicts(const Node& node, int line) const
+    {
+      bool isRow = line < geo.rows;  // true if the line is a row
+      int first = isRow ? line * geo.cols : line - geo.rows;
+      int step = isRow ? 1 : geo.cols;
+      int length = isRow ? geo.cols : geo.rows;
+      int count = 0;  // number of goal tiles in the line
+      int best = 0;   // length of longest increasing subsequence
+
+      for (int k = 0, i = first; k < length; ++k, i += step)
+      {
+        int tile = node.tile(i);
+        if (tile == 0)
+          continue;
+        if (isRow ? geo.row[tile - 1] == geo.row[i] : geo.col[tile - 1] == geo.col[i])
+          goalPos[count++] = isRow ? geo.col[tile - 1] : geo.row[tile - 1];
+      }
+
+      for (int j = 0; j < count; ++j)
+      {
+        longest[j] = 1;
+        for (int k = 0; k < j; ++k)
+        {
+          if (goalPos[k] < goalPos[j] && longest[k] + 1 > longest[j])
+            longest[j] = longest[k] + 1;
+        }
+        if (longest[j] > best)
+          best = longest[j];
+      }
+
+      return count - best;
+    }
+
+    const DynamicGeometry& geo;
+    DynamicManhattanHeuristic<Node> manhattan;
+    mutable std::vector<int> goalPos;  // goal positions along the line of its goal tiles
+    mutable std::vector<int> longest;  // longest increasing run ending at each tile
+};
+
+/*********************************************************************
+ * DynamicPuzzleSolver Class
+ *   Solves a sliding puzzle whose dimensions are only known at runtime,
+ *   for the sizes that no PuzzleSolver specialization is compiled for.
+ *   The search is BasicPuzzleSolver's, as for PuzzleSolver, with the
+ *   heuristics that can be computed from the board alone: Uniform Cost
+ *   Search, Misplaced Tile, Euclidean Distance, Manhattan Distance and
+ *   Linear Conflict.
+ *********************************************************************/
+template <int Capacity>
+class DynamicPuzzleSolver : public BasicPuzzleSolver<DynamicShape<Capacity>>
+{
+  public:
+    using Node = typename BasicPuzzleSolver<DynamicShape<Capacity>>::Node;  // search node type
+
+    // CONSTRUCTOR
+    DynamicPuzzleSolver(const PuzzleState& startState, int rows, int cols)
+      : BasicPuzzleSolver<DynamicShape<Capacity>>(startState, DynamicShape<Capacity>(rows, cols))
+    {}
+
+    // PUBLIC METHODS
+    std::vector<PuzzleState> solve(const std::string& heuristic, bool verbose);
+    std::vector<PuzzleState> solve(int heuristic, bool verbose);
+};
+
+/*********************************************************************
+ *
+ * DynamicPuzzleSolver::solve - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Runs a graph-search algorithm using the heuristic of the given name
+ * to find an optimal solution to the puzzle.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const std::string& heuristic: name of the heuristic to use
+ *       "ucs"               - Uniform Cost Search
+ *       "misplaced"         - A* with Misplaced Tile heuristic
+ *       "euclidean"         - A* with Euclidean Distance heuristic
+ *       "manhattan"         - A* with Manhattan Distance heuristic
+ *       "linear-conflict"   - A* with Manhattan Distance + Linear Conflict
+ *   bool verbose: true to output each step of the search
+ * RETURNS
+ *   The solution to the puzzle in the form of a vector of states
+ *   that represent the optimal sequence of blank square operations
+ *   leading to the goal state.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws invalid_argument if the name is unknown, or if it names one
+ *   of the other heuristics of HEURISTIC_NAMES, which are only
+ *   compiled for the sizes PuzzleSolver is specialized for.
+ * POST-CONDITIONS
+ *   Stores the data collected during the graph-search process in the
+ *   appropriate class attributes.
+ *********************************************************************/
+template <int Capacity>
+std::vector<PuzzleState> DynamicPuzzleSolver<Capacity>::solve(const std::string& heuristic,
+                                                              bool verbose)
+{
+  const DynamicGeometry& geo = this->shape.geo;  // passed to each heuristic policy
+
+  if (heuristic == "ucs")
+    return this->template run<DynamicUniformCostHeuristic<Node>>(heuristic, verbose, geo);
+  else if (heuristic == "misplaced")
+    return this->template run<DynamicMisplacedTileHeuristic<Node>>(heuristic, verbose, geo);
+  else if (heuristic == "euclidean")
+    return this->template run<DynamicEuclideanHeuristic<Node>>(heuristic, verbose, geo);
+  else if (heuristic == "manhattan")
+    return this->template run<DynamicManhattanHeuristic<Node>>(heuristic, verbose, geo);
+  else if (heuristic == "linear-conflict")
+    return this->template run<DynamicLinearConflictHeuristic<Node>>(heuristic, verbose, geo);
+
+  if (std::find(HEURISTIC_NAMES.begin(), HEURISTIC_NAMES.end(), heuristic)
+      != HEURISTIC_NAMES.end())
+  {
+    throw std::invalid_argument("DynamicPuzzleSolver: the \"" + heuristic
+                                + "\" heuristic does not support " + std::to_string(geo.rows)
+                                + "x" + std::to_string(geo.cols) + " puzzles");
+  }
+  throw std::invalid_argument("DynamicPuzzleSolver: unknown heuristic \"" + heuristic + "\"");
+}
+
+/*********************************************************************
+ *
+ * DynamicPuzzleSolver::solve - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Same as the solve() function above, with the heuristic given by its
+ * number in HEURISTIC_NAMES; only numbers 1 to 5 are supported.
+ *********************************************************************/
+template <int Capacity>
+std::vector<PuzzleState> DynamicPuzzleSolver<Capacity>::solve(int heuristic, bool verbose)
+{
+  return solve(heuristicName(heuristic), verbose);
+}
+
+#endif // DYNAMICSOLVER_H
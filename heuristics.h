@@ -0,0 +1,812 @@
+#ifndef HEURISTICS_H
+#define HEURISTICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "boardkernels.h"
+#include "distancetable.h"
+#include "heuristictables.h"
+#include "pdb.h"
+#include "puzzleboard.h"
+#include "walkingdistance.h"
+
+/*********************************************************************
+ *
+ * HEURISTICS
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   HEURISTIC_NAMES, heuristicName: names of the numbered heuristics
+ *   struct HeuristicTraits: default properties of a heuristic policy
+ *   class UniformCostHeuristic: no estimate (Uniform Cost Search)
+ *   class MisplacedTileHeuristic: number of misplaced tiles
+ *   class EuclideanHeuristic: sum of straight-line tile distances
+ *   class ManhattanHeuristic: Manhattan Distance, updated per move
+ *   class LinearConflictHeuristic: Manhattan Distance + Linear Conflict
+ *   class PatternDatabaseHeuristic: additive pattern database cost
+ *   class WalkingDistanceHeuristic: Walking Distance, updated per move
+ *   class ExactDistanceHeuristic: exact distance of small puzzles
+ *   evaluateChildren: costs of all the children of a node together
+ *   class MaxHeuristic: larger of two heuristics
+ *   class LazyHeuristic: cheap bound, refined by an expensive heuristic
+ *                        when needed
+ *
+ * Every heuristic is a policy class that BasicPuzzleSolver::run takes
+ * as a template parameter, so the search loop calls it directly,
+ * with no branch on the heuristic in use. A policy provides:
+ *   float initialize(Node& node) const
+ *     the cost of the starting state, also setting the fields of the
+ *     node that its children's costs are derived from;
+ *   float update(const Node& parent, Node& child) const
+ *     the cost of a child from its parent's fields and the move that
+ *     produced it, also setting the child's fields;
+ *   float evaluate(const Node& node) const
+ *     the cost of any state, calculated from its board alone;
+ *   size_t memoryUsage() const
+ *     the bytes of pattern databases behind the heuristic;
+ * along with the HeuristicTraits constants. A policy whose BATCHED
+ * trait is true also provides
+ *   void updateChildren(const Node& parent, Node children[],
+ *                       float costs[], int count) const
+ *     the costs of count children of the same parent, as update would
+ *     give them, sharing the work on the parent and overlapping the
+ *     children's table lookups.
+ * A policy whose LAZY trait is true also provides
+ *   bool isRefined(const Node& node) const
+ *     whether the node's cost h already includes the expensive part
+ *     of the heuristic;
+ *   float refine(const Node& node) const
+ *     the full cost of a node whose cost h is still the cheap bound.
+ * A new heuristic needs a policy class and a name in
+ * PuzzleSolver::solve, and nothing else.
+ *********************************************************************/
+
+// Names of the heuristics that can also be selected by number: number n names
+// HEURISTIC_NAMES[n - 1]. They are grouped by family: heuristics computed from the
+// board, pattern databases, Walking Distance, the exact table, then combinations
+const std::vector<std::string> HEURISTIC_NAMES = {
+  "ucs",                                    // 1 - Uniform Cost Search
+  "misplaced",                              // 2 - Misplaced Tile
+  "euclidean",                              // 3 - Euclidean Distance
+  "manhattan",                              // 4 - Manhattan Distance
+  "linear-conflict",                        // 5 - Manhattan Distance + Linear Conflict
+  "pdb-663",                                // 6 - additive 6-6-3 pattern databases
+  "pdb-78",                                 // 7 - additive 7-8 pattern databases
+  "pdb-663-symmetric",                      // 8 - 6-6-3 databases, symmetric lookups
+  "pdb-78-symmetric",                       // 9 - 7-8 databases, symmetric lookups
+  "walking-distance",                       // 10 - Walking Distance
+  "exact",                                  // 11 - exact distance table descent
+  "max(walking-distance,linear-conflict)",  // 12 - Walking Distance or Linear Conflict
+  "lazy(pdb-663)",                          // 13 - 6-6-3 databases, evaluated lazily
+  "lazy(pdb-78)",                           // 14 - 7-8 databases, evaluated lazily
+  "lazy(pdb-663-symmetric)",                // 15 - 6-6-3 symmetric, evaluated lazily
+  "lazy(pdb-78-symmetric)"                  // 16 - 7-8 symmetric, evaluated lazily
+};
+
+// Returns the name of a numbered heuristic; throws invalid_argument if no heuristic
+// has the number
+inline std::string heuristicName(int number)
+{
+  if (number < 1 || number > (int)HEURISTIC_NAMES.size())
+    throw std::invalid_argument("unknown heuristic number " + std::to_string(number));
+  return HEURISTIC_NAMES[number - 1];
+}
+
+/*********************************************************************
+ * HeuristicTraits (struct)
+ *   Default properties of a heuristic policy, which policies inherit
+ *   and redefine where they differ:
+ *   - INTEGRAL: costs are whole numbers, so a bucket queue can order
+ *     the frontier; otherwise a binary heap is used;
+ *   - SUPPORTED: the heuristic supports the policy's puzzle size; the
+ *     solver throws invalid_argument otherwise, without constructing
+ *     the policy;
+ *   - USES_BASE_COST: the policy keeps its own cost in the node's
+ *     baseCost field, so two such policies cannot be combined;
+ *   - EXACT: costs are exact distances, so the solver can follow them
+ *     to the goal without searching;
+ *   - BATCHED: the policy evaluates the children of a node together
+ *     with updateChildren; otherwise each child is updated in turn;
+ *   - LAZY: the costs given by initialize and update are cheap lower
+ *     bounds, and the solver refines a node's cost only when it
+ *     reaches the front of the open list.
+ *********************************************************************/
+struct HeuristicTraits
+{
+  static constexpr bool INTEGRAL = true;
+  static constexpr bool SUPPORTED = true;
+  static constexpr bool USES_BASE_COST = false;
+  static constexpr bool EXACT = false;
+  static constexpr bool BATCHED = false;
+  static constexpr bool LAZY = false;
+
+  size_t memoryUsage() const { return 0; }
+};
+
+/*********************************************************************
+ * UniformCostHeuristic Class
+ *   Estimates every cost as 0, which turns A* into Uniform Cost
+ *   Search.
+ *********************************************************************/
+template <int Rows, int Cols>
+class UniformCostHeuristic : public HeuristicTraits
+{
+  public:
+    using Node = SearchNode<BoardFor<Rows * Cols>>;
+
+    float initialize(Node&) const { return 0; }
+    float update(const Node&, Node&) const { return 0; }
+    float evaluate(const Node&) const { return 0; }
+};
+
+/*********************************************************************
+ * MisplacedTileHeuristic Class
+ *   Estimates the cost of a state as the number of tiles that are not
+ *   in their correct positions. The children of a node are evaluated
+ *   together: the parent's board is counted once, and each child's
+ *   cost differs from it only by the slid tile.
+ *********************************************************************/
+template <int Rows, int Cols>
+class MisplacedTileHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool BATCHED = true;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    float initialize(Node& node) const { return evaluate(node); }
+    float update(const Node&, Node& child) const { return evaluate(child); }
+
+    void updateChildren(const Node& parent, Node children[], float costs[], int count) const
+    {
+      int cost = evaluate(parent);
+
+      for (int i = 0; i < count; ++i)
+      {
+        // The slid tile moves from the child's blank square to the parent's
+        int tile = children[i].tile(parent.blankIdx);
+        costs[i] = cost - (tile != children[i].blankIdx + 1) + (tile != parent.blankIdx + 1);
+      }
+    }
+
+    // Counts how many tiles are in incorrect positions, with the vector kernel on
+    // boards stored one byte per square
+    float evaluate(const Node& node) const
+    {
+      if constexpr (LEN > 16)
+        return misplacedTiles<Rows, Cols>(node.board.squares.data());
+      else
+      {
+        int cost = 0;  // Misplaced Tile heuristic cost
+
+        for (int i = 0; i < LEN; ++i)
+        {
+          int tile = node.tile(i);
+          if (tile != 0 && tile != i + 1)
+            cost++;
+        }
+
+        return cost;
+      }
+    }
+};
+
+/*********************************************************************
+ * EuclideanHeuristic Class
+ *   Estimates the cost of a state as the sum of the Euclidean
+ *   distances of the tiles from their correct positions, calculated
+ *   with sqrt((CurrentRow - GoalRow)^2 + (CurrentColumn - GoalColumn)^2).
+ *   The costs are fractional.
+ *********************************************************************/
+template <int Rows, int Cols>
+class EuclideanHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool INTEGRAL = false;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    float initialize(Node& node) const { return evaluate(node); }
+    float update(const Node&, Node& child) const { return evaluate(child); }
+
+    // Sums up the Euclidean distance of each tile
+    float evaluate(const Node& node) const
+    {
+      const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+      float cost = 0;  // Euclidean Distance heuristic cost
+
+      for (int i = 0; i < LEN; ++i)
+      {
+        int tile = node.tile(i);
+        if (tile == 0)
+          continue;
+
+        int rowDist = geo.row[i] - geo.row[tile - 1];
+        int colDist = geo.col[i] - geo.col[tile - 1];
+        cost += std::sqrt(double((rowDist * rowDist) + (colDist * colDist)));
+      }
+
+      return cost;
+    }
+};
+
+/*********************************************************************
+ * ManhattanHeuristic Class
+ *   Estimates the cost of a state as the sum of the Manhattan
+ *   distances of the tiles from their correct positions, read from
+ *   the Manhattan table. A child's cost is its parent's, kept in the
+ *   baseCost field, adjusted by the distance change of the single
+ *   slid tile.
+ *********************************************************************/
+template <int Rows, int Cols>
+class ManhattanHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool USES_BASE_COST = true;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    float initialize(Node& node) const
+    {
+      node.baseCost = evaluate(node);
+      return node.baseCost;
+    }
+
+    float update(const Node& parent, Node& child) const
+    {
+      child.baseCost = parent.baseCost
+                     + manhattan.delta[child.tile(parent.blankIdx)][parent.blankIdx][child.move];
+      return child.baseCost;
+    }
+
+    // Sums up |GoalRow - CurrentRow| + |GoalColumn - CurrentColumn| over the tiles,
+    // with the vector kernel on boards stored one byte per square
+    float evaluate(const Node& node) const
+    {
+      if constexpr (LEN > 16)
+        return manhattanDistance<Rows, Cols>(node.board.squares.data());
+      else
+      {
+        int cost = 0;
+
+        for (int i = 0; i < LEN; ++i)
+        {
+          int tile = node.tile(i);
+          if (tile != 0)
+            cost += manhattan.dist[tile][i];
+        }
+
+        return cost;
+      }
+    }
+
+  private:
+    static constexpr const ManhattanTable<Rows, Cols>& manhattan = MANHATTAN<Rows, Cols>;
+};
+
+/*********************************************************************
+ * LinearConflictHeuristic Class
+ *   Estimates the cost of a state as its Manhattan Distance plus its
+ *   linear conflict cost. Two tiles are in linear conflict if they are
+ *   in the same row, the row is the goal row of both tiles, and their
+ *   goal columns are in the opposite order; conflicts within a column
+ *   are defined in the same way. Resolving the conflicts of a line
+ *   requires some of its tiles to leave the line and come back, which
+ *   costs 2 moves per tile beyond the Manhattan Distance, so each row
+ *   and column adds 2 for every tile in the minimum set of tiles whose
+ *   removal leaves the line free of conflicts.
+ *
+ *   The count of every line is kept in the node, 4 bits per line, and
+ *   the cost in its baseCost field. Sliding a tile into the adjacent
+ *   blank square keeps the order of the tiles along its own line, so
+ *   the conflicts of a child change only in the two lines the tile
+ *   leaves and enters: two rows for an UP or DOWN move, two columns
+ *   for a LEFT or RIGHT move. Only those lines are recounted.
+ *********************************************************************/
+template <int Rows, int Cols>
+class LinearConflictHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool USES_BASE_COST = true;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    float initialize(Node& node) const
+    {
+      node.conflicts = 0;
+      for (int line = 0; line < Rows + Cols; ++line)
+        node.conflicts |= uint64_t(lineConflicts(node, line)) << (4 * line);
+      node.baseCost = evaluate(node);
+      return node.baseCost;
+    }
+
+    float update(const Node& parent, Node& child) const
+    {
+      int cost = parent.baseCost
+               + manhattan.delta[child.tile(parent.blankIdx)][parent.blankIdx][child.move];
+
+      // Lines the tile leaves and enters: rows are lines 0 to Rows - 1 and columns
+      // are lines Rows to Rows + Cols - 1
+      bool vertical = child.move < 2;  // true for UP and DOWN moves
+      int oldLine = vertical ? geo.row[child.blankIdx] : Rows + geo.col[child.blankIdx];
+      int newLine = vertical ? geo.row[parent.blankIdx] : Rows + geo.col[parent.blankIdx];
+
+      for (int line : {oldLine, newLine})
+      {
+        int oldCount = (parent.conflicts >> (4 * line)) & 0xF;
+        int newCount = lineConflicts(child, line);
+        child.conflicts ^= uint64_t(oldCount ^ newCount) << (4 * line);
+        cost += 2 * (newCount - oldCount);
+      }
+
+      child.baseCost = cost;
+      return cost;
+    }
+
+    // Adds 2 for every tile that must leave each row and each column to the
+    // Manhattan Distance
+    float evaluate(const Node& node) const
+    {
+      int cost = ManhattanHeuristic<Rows, Cols>().evaluate(node);
+
+      for (int line = 0; line < Rows + Cols; ++line)
+        cost += 2 * lineConflicts(node, line);
+
+      return cost;
+    }
+
+  private:
+    // Counts the minimum number of tiles that must leave a line: rows are lines
+    // 0 to Rows - 1 and columns are lines Rows to Rows + Cols - 1. On puzzles
+    // whose lines have at most 5 squares, the count is read from the line
+    // conflict table with one key lookup per square
+    static int lineConflicts(const Node& node, int line)
+    {
+      if constexpr (Rows <= 5 && Cols <= 5)
+      {
+        const LineConflictTable<Rows, Cols>& table = LINE_CONFLICTS<Rows, Cols>;
+        int pattern = 0;  // encoded content of the line
+
+        if (line < Rows)
+        {
+          for (int i = line * Cols; i < (line + 1) * Cols; ++i)
+            pattern += table.rowKey[node.tile(i)][i];
+          return table.rowCount[pattern];
+        }
+        for (int i = line - Rows; i < LEN; i += Cols)
+          pattern += table.colKey[node.tile(i)][i];
+        return table.colCount[pattern];
+      }
+      else
+      {
+        if (line < Rows)
+          return lineConflicts(node, line * Cols, 1, Cols, true);
+        return lineConflicts(node, line - Rows, Cols, Rows, false);
+      }
+    }
+
+    // Counts the tiles that must leave the line of length squares starting at
+    // square first, step squares apart. The tiles whose goal line is this line
+    // are listed in order of appearance by their goal position along the line;
+    // the tiles that may stay form an increasing subsequence, so the count is
+    // the number of listed tiles minus the length of the longest one
+    static int lineConflicts(const Node& node, int first, int step, int length, bool isRow)
+    {
+      int goalPos[Rows > Cols ? Rows : Cols];  // goal positions along the line of its goal tiles
+      int longest[Rows > Cols ? Rows : Cols];  // longest increasing run ending at each tile
+      int count = 0;                           // number of goal tiles in the line
+      int best = 0;                            // length of longest increasing subsequence
+
+      for (int k = 0, i = first; k < length; ++k, i += step)
+      {
+        int tile = node.tile(i);
+        if (tile == 0)
+          continue;
+        if (isRow ? geo.row[tile - 1] == geo.row[i] : geo.col[tile - 1] == geo.col[i])
+          goalPos[count++] = isRow ? geo.col[tile - 1] : geo.row[tile - 1];
+      }
+
+      for (int j = 0; j < count; ++j)
+      {
+        longest[j] = 1;
+        for (int k = 0; k < j; ++k)
+        {
+          if (goalPos[k] < goalPos[j] && longest[k] + 1 > longest[j])
+            longest[j] = longest[k] + 1;
+        }
+        if (longest[j] > best)
+          best = longest[j];
+      }
+
+      return count - best;
+    }
+
+    static constexpr const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+    static constexpr const ManhattanTable<Rows, Cols>& manhattan = MANHATTAN<Rows, Cols>;
+};
+
+/*********************************************************************
+ * PatternDatabaseHeuristic Class
+ *   Estimates the cost of a state as the sum of the costs of its
+ *   placement in each pattern database of a 15-puzzle partition. The
+ *   databases are loaded when the policy is constructed. The square of
+ *   every number is collected first, so each database lookup only
+ *   gathers the squares of its own tiles.
+ *
+ *   When Symmetric is true, the cost is the largest of three lookups
+ *   in the same databases:
+ *   - the direct lookup of the state;
+ *   - the reflected lookup: the goal is symmetric about the main
+ *     diagonal, so the state reflected about it, with every number
+ *     replaced by the number whose goal square is the reflection of
+ *     its own, is as far from the goal as the state itself;
+ *   - the dual lookup, when the blank is on its goal square: reading
+ *     the state as a permutation of the squares, its inverse is as far
+ *     from the goal, and the inverse places number n on the goal
+ *     square of the number that is on square n - 1. With the blank
+ *     elsewhere the inverse can be closer to the goal than the state
+ *     and its lookup could overestimate, so it is skipped.
+ *   Each lookup is admissible, so their maximum is too, but the
+ *   reflected and dual lookups of neighboring states can differ by
+ *   more than one move, so the heuristic is not consistent.
+ *
+ *   The children of a node are evaluated together: the squares of the
+ *   numbers are collected from the parent's board once, a child's
+ *   differ from them by the slid tile and the blank, and the direct
+ *   and reflected entries of every child are prefetched before any is
+ *   read, so that their cache misses overlap.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   The puzzle must be a 15-puzzle; the databases must have been
+ *   written by pdbgen, and runtime_error is thrown if they are missing.
+ *********************************************************************/
+template <int Rows, int Cols, bool Symmetric>
+class PatternDatabaseHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool SUPPORTED = Rows == 4 && Cols == 4;
+    static constexpr bool BATCHED = true;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    PatternDatabaseHeuristic(const std::vector<std::vector<int>>& partition)
+      : patterns(AdditivePatternDatabase::get(Rows, Cols, partition)) {}
+
+    size_t memoryUsage() const { return patterns.memoryUsage(); }
+
+    float initialize(Node& node) const { return evaluate(node); }
+    float update(const Node&, Node& child) const { return evaluate(child); }
+
+    void updateChildren(const Node& parent, Node children[], float costs[], int count) const
+    {
+      int parentSquareOf[LEN];            // square of each number in the parent
+      int squareOf[4][LEN];               // square of each number in each child
+      int reflected[4][LEN];              // square of each number in each reflected child
+      const int* placements[2 * 4] = {};  // children's placements, then their reflections
+      int totals[2 * 4];                  // costs of the placements
+
+      for (int i = 0; i < LEN; ++i)
+        parentSquareOf[parent.tile(i)] = i;
+
+      for (int c = 0; c < count; ++c)
+      {
+        // The slid tile takes the parent's blank square, and the blank takes its square
+        std::copy(parentSquareOf, parentSquareOf + LEN, squareOf[c]);
+        squareOf[c][children[c].tile(parent.blankIdx)] = parent.blankIdx;
+        squareOf[c][0] = children[c].blankIdx;
+        placements[c] = squareOf[c];
+        if constexpr (Symmetric)
+        {
+          reflect(squareOf[c], reflected[c]);
+          placements[count + c] = reflected[c];
+        }
+      }
+
+      patterns.costs(placements, Symmetric ? 2 * count : count, totals);
+
+      for (int c = 0; c < count; ++c)
+      {
+        int cost = totals[c];
+        if constexpr (Symmetric)
+        {
+          cost = std::max(cost, totals[count + c]);
+          if (children[c].blankIdx == LEN - 1)
+            cost = std::max(cost, dualCost(children[c]));
+        }
+        costs[c] = cost;
+      }
+    }
+
+    float evaluate(const Node& node) const
+    {
+      int squareOf[LEN];  // square of each number
+
+      for (int i = 0; i < LEN; ++i)
+        squareOf[node.tile(i)] = i;
+      int cost = patterns.cost(squareOf);
+      if constexpr (!Symmetric)
+        return cost;
+
+      int reflected[LEN];  // square of each number in the reflected state
+      reflect(squareOf, reflected);
+      cost = std::max(cost, patterns.cost(reflected));
+
+      if (node.blankIdx == LEN - 1)
+        cost = std::max(cost, dualCost(node));
+
+      return cost;
+    }
+
+  private:
+    // Sets the square of each number in the state reflected about the main diagonal,
+    // given the square of each number in the state
+    static void reflect(const int* squareOf, int* reflected)
+    {
+      for (int n = 1; n < LEN; ++n)
+      {
+        int square = squareOf[geo.col[n - 1] * Cols + geo.row[n - 1] + 1];
+        reflected[n] = geo.col[square] * Cols + geo.row[square];
+      }
+    }
+
+    // Returns the cost of the dual state of a state whose blank is on its goal square
+    int dualCost(const Node& node) const
+    {
+      int dual[LEN];  // square of each number in the dual state
+      for (int n = 1; n < LEN; ++n)
+        dual[n] = node.tile(n - 1) - 1;
+      return patterns.cost(dual);
+    }
+
+    static constexpr const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+    const AdditivePatternDatabase& patterns;  // databases of the partition
+};
+
+/*********************************************************************
+ * WalkingDistanceHeuristic Class
+ *   Estimates the cost of a state as its Walking Distance: the sum of
+ *   the least numbers of vertical and of horizontal moves that bring
+ *   every tile into its goal row and its goal column, counting tiles
+ *   only by the row or column they are in, as listed in the Walking
+ *   Distance table. Unlike the Manhattan Distance, it charges for the
+ *   tiles that must make room for each other, while it does not see
+ *   linear conflicts within a line.
+ *
+ *   The node keeps the numbers of its row and column matrices in the
+ *   table; the matrices of a child are those of the parent with the
+ *   one the move changes replaced by its successor in the table.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   The puzzle must be square, with at most 4 squares per line.
+ *********************************************************************/
+template <int Rows, int Cols>
+class WalkingDistanceHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr int LEN = Rows * Cols;
+    static constexpr bool SUPPORTED = Rows == Cols && Rows <= 4;
+    using Node = SearchNode<BoardFor<LEN>>;
+
+    // Builds the table, if needed, before the search starts
+    WalkingDistanceHeuristic() { table(); }
+
+    float initialize(Node& node) const
+    {
+      matrices(node, node.walkRows, node.walkCols);
+      return table().cost(node.walkRows) + table().cost(node.walkCols);
+    }
+
+    float update(const Node& parent, Node& child) const
+    {
+      // The move carries the slid tile across the rows or across the columns
+      int tile = child.tile(parent.blankIdx);
+      if (child.move < 2)
+        child.walkRows = table().next(parent.walkRows, child.move, geo.row[tile - 1]);
+      else
+        child.walkCols = table().next(parent.walkCols, child.move - 2, geo.col[tile - 1]);
+      return table().cost(child.walkRows) + table().cost(child.walkCols);
+    }
+
+    float evaluate(const Node& node) const
+    {
+      uint16_t rows, cols;  // Walking Distance matrices of the state
+      matrices(node, rows, cols);
+      return table().cost(rows) + table().cost(cols);
+    }
+
+  private:
+    static const WalkingDistanceTable<Rows>& table() { return WalkingDistanceTable<Rows>::get(); }
+
+    // Counts the tiles of each row by goal row and the tiles of each column by
+    // goal column, and looks both matrices up in the table
+    static void matrices(const Node& node, uint16_t& rows, uint16_t& cols)
+    {
+      int rowCounts[Rows][Rows] = {};  // tiles of each row by goal row
+      int colCounts[Rows][Rows] = {};  // tiles of each column by goal column
+
+      for (int i = 0; i < LEN; ++i)
+      {
+        int tile = node.tile(i);
+        if (tile == 0)
+          continue;
+        rowCounts[geo.row[i]][geo.row[tile - 1]]++;
+        colCounts[geo.col[i]][geo.col[tile - 1]]++;
+      }
+
+      rows = table().index(rowCounts);
+      cols = table().index(colCounts);
+    }
+
+    static constexpr const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+};
+
+/*********************************************************************
+ * ExactDistanceHeuristic Class
+ *   Reads the exact distance of a state to the goal from the distance
+ *   table, which is filled the first time the policy is constructed
+ *   in a process. The solver
+ *   follows these distances to the goal instead of searching.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   The puzzle must have at most 9 squares.
+ *********************************************************************/
+template <int Rows, int Cols>
+class ExactDistanceHeuristic : public HeuristicTraits
+{
+  public:
+    static constexpr bool SUPPORTED = Rows * Cols <= 9;
+    static constexpr bool EXACT = true;
+    using Node = SearchNode<BoardFor<Rows * Cols>>;
+
+    // Fills the table, if needed, before the descent starts
+    ExactDistanceHeuristic() { DistanceTable<Rows, Cols>::get(); }
+
+    float initialize(Node& node) const { return evaluate(node); }
+    float update(const Node&, Node& child) const { return evaluate(child); }
+
+    float evaluate(const Node& node) const
+    {
+      return DistanceTable<Rows, Cols>::get().distance(node.board);
+    }
+};
+
+// Sets the costs of count children of the same parent, each as the policy's update
+// gives it, with one call to its updateChildren if it evaluates children together
+template <typename Heuristic, typename Node>
+void evaluateChildren(const Heuristic& heuristic, const Node& parent, Node children[],
+                      float costs[], int count)
+{
+  if constexpr (Heuristic::BATCHED)
+    heuristic.updateChildren(parent, children, costs, count);
+  else
+  {
+    for (int i = 0; i < count; ++i)
+      costs[i] = heuristic.update(parent, children[i]);
+  }
+}
+
+/*********************************************************************
+ * MaxHeuristic Class
+ *   Estimates the cost of a state as the larger of the costs given by
+ *   two policies, each updated from the parent's fields in turn. If
+ *   both are admissible, or both consistent, so is their maximum.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   At most one of the policies may keep its cost in the baseCost
+ *   field.
+ *********************************************************************/
+template <typename First, typename Second>
+class MaxHeuristic : public HeuristicTraits
+{
+  static_assert(!(First::USES_BASE_COST && Second::USES_BASE_COST),
+                "Only one heuristic of a maximum can keep its cost in the node");
+
+  public:
+    static constexpr bool INTEGRAL = First::INTEGRAL && Second::INTEGRAL;
+    static constexpr bool SUPPORTED = First::SUPPORTED && Second::SUPPORTED;
+    static constexpr bool USES_BASE_COST = First::USES_BASE_COST || Second::USES_BASE_COST;
+    static constexpr bool BATCHED = First::BATCHED || Second::BATCHED;
+    using Node = typename First::Node;
+
+    MaxHeuristic(const First& first = First(), const Second& second = Second())
+      : first(first), second(second) {}
+
+    size_t memoryUsage() const { return first.memoryUsage() + second.memoryUsage(); }
+
+    float initialize(Node& node) const
+    {
+      return std::max(first.initialize(node), second.initialize(node));
+    }
+
+    float update(const Node& parent, Node& child) const
+    {
+      return std::max(first.update(parent, child), second.update(parent, child));
+    }
+
+    void updateChildren(const Node& parent, Node children[], float costs[], int count) const
+    {
+      float secondCosts[4];  // costs of the children given by the second policy
+
+      evaluateChildren(first, parent, children, costs, count);
+      evaluateChildren(second, parent, children, secondCosts, count);
+      for (int i = 0; i < count; ++i)
+        costs[i] = std::max(costs[i], secondCosts[i]);
+    }
+
+    float evaluate(const Node& node) const
+    {
+      return std::max(first.evaluate(node), second.evaluate(node));
+    }
+
+  private:
+    First first;
+    Second second;
+};
+
+/*********************************************************************
+ * LazyHeuristic Class
+ *   Estimates the cost of a state as the larger of a cheap policy,
+ *   updated from the parent's fields, and an expensive policy, which
+ *   is only evaluated when the solver asks for it. Children are added
+ *   to the frontier with the cheap cost alone; when a node reaches
+ *   the front of the open list its cost is refined, and if the cost
+ *   rose, the node goes back into the open list instead of being
+ *   expanded. Most generated nodes are never expanded, so most never
+ *   pay for the expensive heuristic. Both costs are admissible lower
+ *   bounds, so the search still finds an optimal solution.
+ *
+ *   The cheap policy keeps its cost in the baseCost field, so a node
+ *   whose cost h is larger than its baseCost has been refined. A node
+ *   whose expensive cost did not exceed its cheap one is expanded as
+ *   soon as it is refined, and is only refined again if the search
+ *   reopens it.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   The cheap policy must keep its cost in the baseCost field, and
+ *   the expensive policy must not use it.
+ *********************************************************************/
+template <typename Cheap, typename Expensive>
+class LazyHeuristic : public HeuristicTraits
+{
+  static_assert(Cheap::USES_BASE_COST && !Expensive::USES_BASE_COST,
+                "The cheap heuristic of a lazy heuristic must keep its cost in the node");
+
+  public:
+    static constexpr bool INTEGRAL = Cheap::INTEGRAL && Expensive::INTEGRAL;
+    static constexpr bool SUPPORTED = Cheap::SUPPORTED && Expensive::SUPPORTED;
+    static constexpr bool USES_BASE_COST = true;
+    static constexpr bool LAZY = true;
+    using Node = typename Cheap::Node;
+
+    // Constructs the expensive policy from the given arguments
+    template <typename... Args>
+    LazyHeuristic(const Args&... args) : expensive(args...) {}
+
+    size_t memoryUsage() const { return cheap.memoryUsage() + expensive.memoryUsage(); }
+
+    float initialize(Node& node) const { return cheap.initialize(node); }
+    float update(const Node& parent, Node& child) const { return cheap.update(parent, child); }
+
+    bool isRefined(const Node& node) const { return node.h > node.baseCost; }
+
+    float refine(const Node& node) const
+    {
+      return std::max(node.h, expensive.evaluate(node));
+    }
+
+    float evaluate(const Node& node) const
+    {
+      return std::max(cheap.evaluate(node), expensive.evaluate(node));
+    }
+
+  private:
+    Cheap cheap;
+    Expensive expensive;
+};
+
+#endif // HEURISTICS_H
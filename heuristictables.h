@@ -0,0 +1,171 @@
+#ifndef HEURISTICTABLES_H
+#define HEURISTICTABLES_H
+
+#include <cstdint>
+#include "puzzleboard.h"
+
+/*********************************************************************
+ *
+ * HEURISTICTABLES
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct ManhattanTable: compile-time Manhattan distances and deltas
+ *   linePower: integer power used to encode line patterns
+ *   lineRemovals: linear conflict count of an encoded line
+ *   struct LineConflictTable: compile-time linear conflicts of every line
+ *********************************************************************/
+
+/*********************************************************************
+ * ManhattanTable (struct)
+ *   Holds the Manhattan distance of every number from every square of
+ *   a Rows x Cols puzzle, and the change in a board's total Manhattan
+ *   distance caused by every blank square move. A move slides exactly
+ *   one tile, so a child's Manhattan distance is its parent's plus a
+ *   single delta lookup indexed by the slid number, the square of the
+ *   blank before the move and the move code.
+ *********************************************************************/
+template <int Rows, int Cols>
+struct ManhattanTable
+{
+  static constexpr int LEN = Rows * Cols;  // number of squares
+
+  int8_t dist[LEN][LEN];      // distance of number n (1 to LEN - 1) on square i
+  int8_t delta[LEN][LEN][4];  // change in distance when the blank on square b takes
+                              // move code m and number n slides into square b
+
+  constexpr ManhattanTable() : dist(), delta()
+  {
+    const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+
+    for (int n = 1; n < LEN; ++n)
+    {
+      for (int i = 0; i < LEN; ++i)
+      {
+        int rowDist = geo.row[n - 1] - geo.row[i];
+        int colDist = geo.col[n - 1] - geo.col[i];
+        dist[n][i] = (rowDist < 0 ? -rowDist : rowDist) + (colDist < 0 ? -colDist : colDist);
+      }
+    }
+
+    for (int n = 1; n < LEN; ++n)
+    {
+      for (int b = 0; b < LEN; ++b)
+      {
+        for (int m = 0; m < 4; ++m)
+        {
+          int from = geo.neighbor[b][m];
+          if (from >= 0)
+            delta[n][b][m] = dist[n][b] - dist[n][from];
+        }
+      }
+    }
+  }
+};
+
+// Manhattan tables of every puzzle shape, instantiated once per shape
+template <int Rows, int Cols>
+inline constexpr ManhattanTable<Rows, Cols> MANHATTAN{};
+
+// Returns base raised to the given exponent
+constexpr int linePower(int base, int exponent)
+{
+  int result = 1;
+  for (int k = 0; k < exponent; ++k)
+    result *= base;
+  return result;
+}
+
+/*********************************************************************
+ * lineRemovals
+ *   Returns the minimum number of tiles that must leave a line of the
+ *   given length, of up to 5 squares, whose content is encoded as the
+ *   given LineConflictTable pattern.
+ *********************************************************************/
+constexpr int lineRemovals(int pattern, int length)
+{
+  int goalPos[5] = {};  // goal positions of the line's goal tiles, in line order
+  int longest[5] = {};  // longest increasing run ending at each tile
+  int count = 0;        // number of goal tiles in the line
+  int best = 0;         // length of longest increasing subsequence
+
+  // The first square of the line is the most significant digit
+  for (int k = length - 1; k >= 0; --k)
+  {
+    int digit = pattern / linePower(length + 1, k) % (length + 1);
+    if (digit != 0)
+      goalPos[count++] = digit - 1;
+  }
+
+  for (int j = 0; j < count; ++j)
+  {
+    longest[j] = 1;
+    for (int k = 0; k < j; ++k)
+    {
+      if (goalPos[k] < goalPos[j] && longest[k] + 1 > longest[j])
+        longest[j] = longest[k] + 1;
+    }
+    if (longest[j] > best)
+      best = longest[j];
+  }
+
+  return count - best;
+}
+
+/*********************************************************************
+ * LineConflictTable (struct)
+ *   Holds the minimum number of tiles that must leave a row or column
+ *   of a Rows x Cols puzzle to resolve its linear conflicts, for every
+ *   possible content of the line. The content of a line of length L
+ *   is encoded as a base L+1 number with one digit per square: the
+ *   goal position along the line plus one of a tile whose goal line
+ *   is this line, or 0 for the blank and every other tile. Each
+ *   number contributes a precomputed key to the pattern of its row
+ *   and of its column, so a line's pattern is the sum of L keys and
+ *   its count is one further lookup. The count of a pattern is the
+ *   number of its goal tiles minus the length of the longest
+ *   increasing subsequence of their goal positions.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   Lines must not exceed 5 squares (7,776 patterns).
+ *********************************************************************/
+template <int Rows, int Cols>
+struct LineConflictTable
+{
+  static constexpr int LEN = Rows * Cols;                       // number of squares
+  static constexpr int ROW_PATTERNS = linePower(Cols + 1, Cols);  // patterns of a row
+  static constexpr int COL_PATTERNS = linePower(Rows + 1, Rows);  // patterns of a column
+
+  uint16_t rowKey[LEN][LEN];            // key of number n on square i in its row
+  uint16_t colKey[LEN][LEN];            // key of number n on square i in its column
+  uint8_t rowCount[ROW_PATTERNS];       // tiles that must leave a row, by pattern
+  uint8_t colCount[COL_PATTERNS];       // tiles that must leave a column, by pattern
+
+  constexpr LineConflictTable() : rowKey(), colKey(), rowCount(), colCount()
+  {
+    const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+
+    for (int n = 1; n < LEN; ++n)
+    {
+      for (int i = 0; i < LEN; ++i)
+      {
+        if (geo.row[n - 1] == geo.row[i])
+          rowKey[n][i] = (geo.col[n - 1] + 1) * linePower(Cols + 1, Cols - 1 - geo.col[i]);
+        if (geo.col[n - 1] == geo.col[i])
+          colKey[n][i] = (geo.row[n - 1] + 1) * linePower(Rows + 1, Rows - 1 - geo.row[i]);
+      }
+    }
+
+    for (int pattern = 0; pattern < ROW_PATTERNS; ++pattern)
+      rowCount[pattern] = lineRemovals(pattern, Cols);
+    for (int pattern = 0; pattern < COL_PATTERNS; ++pattern)
+      colCount[pattern] = lineRemovals(pattern, Rows);
+  }
+};
+
+// Line conflict tables of every puzzle shape with lines of up to 5 squares,
+// instantiated once per shape
+template <int Rows, int Cols>
+inline constexpr LineConflictTable<Rows, Cols> LINE_CONFLICTS{};
+
+#endif // HEURISTICTABLES_H
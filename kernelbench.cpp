@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "boardkernels.h"
+using namespace std;
+
+const int BOARDS = 4096;    // random boards evaluated by each measurement
+const int REPEATS = 500;    // passes over the boards by each measurement
+
+// Sum of the results of every measurement, printed so that no evaluation is optimized away
+long checksum = 0;
+
+// Returns the mean time in nanoseconds of evaluating one of the boards with a kernel
+template <typename Kernel>
+double measure(const vector<vector<uint8_t>>& boards, Kernel kernel) {
+  auto start = chrono::steady_clock::now();
+  for (int r = 0; r < REPEATS; ++r) {
+    for (const vector<uint8_t>& board : boards)
+      checksum += kernel(board.data());
+  }
+  chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+  return elapsed.count() / (double(REPEATS) * boards.size());
+}
+
+// Prints the time per board of the scalar kernel and of each vector kernel the
+// processor supports
+template <typename Scalar, typename Sse2, typename Avx2>
+void report(const string& name, const vector<vector<uint8_t>>& boards, Scalar scalar,
+            Sse2 sse2, Avx2 avx2) {
+  cout << left << setw(16) << name << right << fixed << setprecision(1);
+  cout << setw(9) << measure(boards, scalar);
+#ifdef BOARDKERNELS_X86
+  if (simdLevel() >= SimdLevel::SSE2)
+    cout << setw(9) << measure(boards, sse2);
+  else
+    cout << setw(9) << "-";
+  if (simdLevel() >= SimdLevel::AVX2)
+    cout << setw(9) << measure(boards, avx2);
+  else
+    cout << setw(9) << "-";
+#else
+  cout << setw(9) << "-" << setw(9) << "-";
+#endif
+  cout << endl;
+}
+
+// Times both kernels on random boards of a Rows x Cols puzzle
+template <int Rows, int Cols>
+void benchmark(mt19937& rng) {
+  constexpr int LEN = Rows * Cols;
+  vector<vector<uint8_t>> boards(BOARDS, vector<uint8_t>(LEN));
+  for (vector<uint8_t>& board : boards) {
+    for (int i = 0; i < LEN; ++i)
+      board[i] = i;
+    shuffle(board.begin(), board.end(), rng);
+  }
+
+  string size = to_string(Rows) + "x" + to_string(Cols);
+#ifdef BOARDKERNELS_X86
+  report("misplaced " + size, boards, misplacedTilesScalar<Rows, Cols>,
+         misplacedTilesSse2<Rows, Cols>, misplacedTilesAvx2<Rows, Cols>);
+  report("manhattan " + size, boards, manhattanDistanceScalar<Rows, Cols>,
+         manhattanDistanceSse2<Rows, Cols>, manhattanDistanceAvx2<Rows, Cols>);
+#else
+  report("misplaced " + size, boards, misplacedTilesScalar<Rows, Cols>, nullptr, nullptr);
+  report("manhattan " + size, boards, manhattanDistanceScalar<Rows, Cols>, nullptr, nullptr);
+#endif
+}
+
+int main() {
+  mt19937 rng(1);
+
+  cout << "Nanoseconds per board of the Misplaced Tile and Manhattan Distance" << endl;
+  cout << "kernels on " << BOARDS << " random boards (- where unsupported):" << endl;
+  cout << endl;
+  cout << left << setw(16) << "" << right << setw(9) << "scalar" << setw(9) << "SSE2";
+  cout << setw(9) << "AVX2" << endl;
+  benchmark<5, 5>(rng);
+  benchmark<6, 6>(rng);
+  benchmark<7, 7>(rng);
+  cout << endl << "(checksum " << checksum << ")" << endl;
+
+  return 0;
+}
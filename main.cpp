@@ -1,64 +1,114 @@
-#include <iostream>
-#include <string>
-#include <vector>
-#include "npuzzle.h"
-#include "puzzles.h"
-using namespace std;
-
-int main() {
-  int puzzleChoice = 1;
-  int algorithmChoice = 1;
-  string puzzleInput = "";
-  vector<int> puzzle = DefaultPuzzle::Fifteen::waitForIt;
-
-  cout << "Welcome to Group 26's 8 puzzle solver." << endl;
-  cout << "Type \"1\" to use a default puzzle, or \"2\" to enter your own puzzle: ";
-  cin >> puzzleChoice;
-  cin.ignore();
-
-  if (puzzleChoice != 1 && puzzleChoice != 2) {
-    cout << endl << "Invalid input. Exiting..." << endl;
-    return 0;
-  }
-
-  if (puzzleChoice == 2) {
-    cout << endl;
-    cout << "Enter your puzzle on one line. Use space between numbers," << endl;
-    cout << "and 0 to represent the blank. Press ENTER/RETURN when done." << endl;
-    cout << "Enter puzzle: ";
-    getline(cin, puzzleInput);
-    cin.ignore();
-
-    string intStr = "";
-    puzzle.clear();
-    for (int i = 0; i < puzzleInput.length(); ++i) {
-      if (puzzleInput[i] == ' ') {
-        puzzle.push_back(stoi(intStr));
-        intStr = "";
-        continue;
-      }
-      intStr += puzzleInput[i];
-    }
-    puzzle.push_back(stoi(intStr));
-  }
-
-  cout << endl;
-  cout << "1. Uniform Cost Search" << endl;
-  cout << "2. A* with the Misplaced Tile heuristic." << endl;
-  cout << "3. A* with the Euclidean distance heuristic." << endl;
-  cout << "Enter your choice of algorithm: ";
-  cin >> algorithmChoice;
-  cin.ignore();
-
-  if (algorithmChoice < 1 || algorithmChoice > 5) {
-    cout << endl << "Invalid input. Exiting..." << endl;
-    return 0;
-  }
-  cout << endl;
-
-  NPuzzle thePuzzle(puzzle);
-  thePuzzle.solvePuzzle(algorithmChoice);
-  thePuzzle.displaySolution();
-
-  return 0;
-}
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "heuristics.h"
+#include "npuzzle.h"
+#include "pdb.h"
+#include "puzzles.h"
+using namespace std;
+
+int main() {
+  int puzzleChoice = 1;
+  int algorithmChoice = 1;
+  string algorithmInput = "";
+  string puzzleInput = "";
+  vector<int> puzzle = DefaultPuzzle::Fifteen::waitForIt;
+
+  // Pattern databases are read from the directory named by NPUZZLE_PDB_DIR, or from
+  // "pdb" if it is not set
+  if (const char* pdbDirectory = getenv("NPUZZLE_PDB_DIR"))
+    AdditivePatternDatabase::setDirectory(pdbDirectory);
+
+  // Their checksums are verified unless NPUZZLE_PDB_VERIFY is set to 0
+  if (const char* pdbVerify = getenv("NPUZZLE_PDB_VERIFY"))
+    AdditivePatternDatabase::setVerification(string(pdbVerify) != "0");
+
+  cout << "Welcome to Group 26's 8 puzzle solver." << endl;
+  cout << "Type \"1\" to use a default puzzle, or \"2\" to enter your own puzzle: ";
+  cin >> puzzleChoice;
+  cin.ignore();
+
+  if (puzzleChoice != 1 && puzzleChoice != 2) {
+    cout << endl << "Invalid input. Exiting..." << endl;
+    return 0;
+  }
+
+  if (puzzleChoice == 2) {
+    cout << endl;
+    cout << "Enter your puzzle on one line. Use space between numbers," << endl;
+    cout << "and 0 to represent the blank. Press ENTER/RETURN when done." << endl;
+    cout << "Enter puzzle: ";
+    getline(cin, puzzleInput);
+
+    string intStr = "";
+    puzzle.clear();
+    for (int i = 0; i < puzzleInput.length(); ++i) {
+      if (puzzleInput[i] == ' ') {
+        puzzle.push_back(stoi(intStr));
+        intStr = "";
+        continue;
+      }
+      intStr += puzzleInput[i];
+    }
+    puzzle.push_back(stoi(intStr));
+  }
+
+  cout << endl;
+  cout << "1. Uniform Cost Search" << endl;
+  cout << "2. A* with the Misplaced Tile heuristic." << endl;
+  cout << "3. A* with the Euclidean distance heuristic." << endl;
+  cout << "4. A* with the Manhattan distance heuristic." << endl;
+  cout << "5. A* with the Manhattan distance + Linear Conflict heuristic." << endl;
+  cout << "6. A* with additive 6-6-3 pattern databases (15-puzzle only)." << endl;
+  cout << "7. A* with additive 7-8 pattern databases (15-puzzle only)." << endl;
+  cout << "8. A* with 6-6-3 pattern databases and symmetric lookups (15-puzzle only)." << endl;
+  cout << "9. A* with 7-8 pattern databases and symmetric lookups (15-puzzle only)." << endl;
+  cout << "10. A* with the Walking Distance heuristic (up to 15-puzzle)." << endl;
+  cout << "11. Exact distance table, without searching (up to 8-puzzle)." << endl;
+  cout << "12. A* with the larger of Walking Distance and Linear Conflict (up to 15-puzzle)." << endl;
+  cout << "13. Lazy A* with 6-6-3 pattern databases (15-puzzle only)." << endl;
+  cout << "14. Lazy A* with 7-8 pattern databases (15-puzzle only)." << endl;
+  cout << "15. Lazy A* with 6-6-3 pattern databases and symmetric lookups (15-puzzle only)." << endl;
+  cout << "16. Lazy A* with 7-8 pattern databases and symmetric lookups (15-puzzle only)." << endl;
+  cout << "Enter your choice of algorithm, by number or by name: ";
+  cin >> algorithmInput;
+  cin.ignore();
+
+  bool isNumber = !algorithmInput.empty() && algorithmInput.size() <= 2 &&
+                  algorithmInput.find_first_not_of("0123456789") == string::npos;
+  if (isNumber)
+    algorithmChoice = stoi(algorithmInput);
+  if (isNumber && (algorithmChoice < 1 || algorithmChoice > (int)HEURISTIC_NAMES.size())) {
+    cout << endl << "Invalid input. Exiting..." << endl;
+    return 0;
+  }
+  cout << endl;
+
+  try {
+    NPuzzle thePuzzle(puzzle);
+    if (isNumber)
+      thePuzzle.solve(algorithmChoice);
+    else
+      thePuzzle.solve(algorithmInput);
+    thePuzzle.displaySolution();
+
+    double seconds = thePuzzle.searchTime();
+    cout << "Nodes expanded: " << thePuzzle.nodesExpanded() << endl;
+    cout << "Search time: " << seconds << " seconds";
+    if (seconds > 0)
+      cout << " (" << (long)(thePuzzle.nodesExpanded() / seconds) << " nodes/second)";
+    cout << endl;
+    if (thePuzzle.patternMemory() > 0)
+      cout << "Pattern database memory: " << thePuzzle.patternMemory() << " bytes" << endl;
+    if (thePuzzle.evaluationsSaved() > 0)
+      cout << "Heuristic evaluations saved: " << thePuzzle.evaluationsSaved() << endl;
+  }
+  catch (const exception& e) {
+    cout << e.what() << endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef NODEARENA_H
+#define NODEARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*********************************************************************
+ *
+ * NODEARENA
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   NodeIndex: 32-bit index of a node within a NodeArena
+ *   class NodeArena: chunked pool that owns every node of a search
+ *********************************************************************/
+
+// Index of a node within a NodeArena, and the index that refers to no node
+using NodeIndex = uint32_t;
+constexpr NodeIndex NO_NODE = 0xFFFFFFFF;
+
+/*********************************************************************
+ * NodeArena Class
+ *   Owns every node created during a search. Nodes are allocated in
+ *   fixed-size chunks and never move once allocated, so the open
+ *   list, the state tables and the parent links can all refer to a
+ *   node by its 32-bit index, and a reference to a node stays valid
+ *   while further nodes are allocated. Allocation only touches the
+ *   heap when a chunk fills up; every node is released at once when
+ *   the arena is cleared or destroyed.
+ *********************************************************************/
+template <typename Node>
+class NodeArena
+{
+  public:
+    static constexpr int CHUNK_BITS = 14;                // log2 of the nodes per chunk
+    static constexpr NodeIndex CHUNK_SIZE = 1 << CHUNK_BITS;
+
+    NodeArena() : count(0) {}
+
+    // Allocates a node initialized to the given value and returns its index
+    NodeIndex allocate(const Node& node)
+    {
+      if (count == chunks.size() * CHUNK_SIZE)
+        chunks.emplace_back(new Node[CHUNK_SIZE]);
+      (*this)[count] = node;
+      return count++;
+    }
+
+    Node& operator[](NodeIndex idx)
+    {
+      return chunks[idx >> CHUNK_BITS][idx & (CHUNK_SIZE - 1)];
+    }
+
+    const Node& operator[](NodeIndex idx) const
+    {
+      return chunks[idx >> CHUNK_BITS][idx & (CHUNK_SIZE - 1)];
+    }
+
+    // Releases every node
+    void clear()
+    {
+      chunks.clear();
+      count = 0;
+    }
+
+    size_t size() const { return count; }
+    size_t memoryUsage() const { return chunks.size() * CHUNK_SIZE * sizeof(Node); }
+
+  private:
+    std::vector<std::unique_ptr<Node[]>> chunks;  // fixed-size blocks of nodes
+    NodeIndex count;                              // number of nodes allocated
+};
+
+#endif // NODEARENA_H
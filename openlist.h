@@ -0,0 +1,223 @@
+#ifndef OPENLIST_H
+#define OPENLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "nodearena.h"
+
+/*********************************************************************
+ *
+ * OPENLIST
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class BucketQueue: open list for integer total costs
+ *   class HeapQueue: open list for fractional total costs
+ *
+ * Both open lists hold arena indices of frontier nodes, order them by
+ * increasing total cost f(n) and break ties in favor of the node with
+ * the greater cost g(n), so that nodes closer to a goal on the last
+ * f-layer are expanded first. Node indices are dense, so each list
+ * records where every queued node sits in a vector indexed by node,
+ * which lets a node be moved in place when a shorter path to it is
+ * found. They share the interface push(node, f, g), update(node, f,
+ * g), pop(), empty() and size().
+ *********************************************************************/
+
+/*********************************************************************
+ * BucketQueue Class
+ *   Open list for searches in which every total cost f(n) is an
+ *   integer. Nodes are kept in one bucket per f value, and each bucket
+ *   is split into sub-buckets by g value. Pushing is O(1); popping
+ *   takes the deepest sub-bucket of the lowest non-empty bucket and
+ *   returns its most recently pushed node (LIFO), advancing the
+ *   lowest-bucket and deepest-sub-bucket cursors only as they empty.
+ *   Updating a node removes it from its sub-bucket by moving the
+ *   sub-bucket's last node into its place, then pushes it again, so
+ *   it is also O(1).
+ *********************************************************************/
+class BucketQueue
+{
+  public:
+    BucketQueue() : minF(0), count(0) {}
+
+    // Adds a node with total cost f and path cost g
+    void push(NodeIndex node, int f, int g)
+    {
+      if (f >= (int)layers.size())
+        layers.resize(f + 1);
+      Layer& layer = layers[f];
+      if (g >= (int)layer.byG.size())
+        layer.byG.resize(g + 1);
+      if (node >= where.size())
+        where.resize(node + 1);
+
+      std::vector<NodeIndex>& bucket = layer.byG[g];
+      where[node] = Position{f, g, (uint32_t)bucket.size()};
+      bucket.push_back(node);
+      layer.count++;
+      if (g > layer.maxG)
+        layer.maxG = g;
+      if (count == 0 || f < minF)
+        minF = f;
+      count++;
+    }
+
+    // Moves a queued node to total cost f and path cost g
+    void update(NodeIndex node, int f, int g)
+    {
+      const Position pos = where[node];
+      Layer& layer = layers[pos.f];
+      std::vector<NodeIndex>& bucket = layer.byG[pos.g];
+
+      NodeIndex last = bucket.back();
+      bucket[pos.slot] = last;
+      where[last].slot = pos.slot;
+      bucket.pop_back();
+      layer.count--;
+      count--;
+
+      push(node, f, g);
+    }
+
+    // Removes and returns the node with the least f, then the greatest g
+    NodeIndex pop()
+    {
+      while (layers[minF].count == 0)
+        minF++;
+      Layer& layer = layers[minF];
+      while (layer.byG[layer.maxG].empty())
+        layer.maxG--;
+
+      std::vector<NodeIndex>& bucket = layer.byG[layer.maxG];
+      NodeIndex node = bucket.back();
+      bucket.pop_back();
+      layer.count--;
+      count--;
+      return node;
+    }
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+  private:
+    struct Layer
+    {
+      std::vector<std::vector<NodeIndex>> byG;  // nodes of this f value, indexed by g
+      size_t count = 0;                         // number of nodes in the layer
+      int maxG = -1;                            // no sub-bucket above maxG holds nodes
+    };
+
+    struct Position
+    {
+      int f;          // bucket holding the node
+      int g;          // sub-bucket holding the node
+      uint32_t slot;  // index of the node within its sub-bucket
+    };
+
+    std::vector<Layer> layers;     // buckets indexed by f
+    std::vector<Position> where;   // position of every queued node, indexed by node
+    int minF;                      // no bucket below minF holds nodes
+    size_t count;                  // number of nodes in the queue
+};
+
+/*********************************************************************
+ * HeapQueue Class
+ *   Open list for searches whose total costs may be fractional, such
+ *   as with the Euclidean Distance heuristic, implemented as a binary
+ *   min-heap that records the heap slot of every queued node. Pushing,
+ *   popping and updating a node each sift one entry in O(log n).
+ *********************************************************************/
+class HeapQueue
+{
+  public:
+    // Adds a node with total cost f and path cost g
+    void push(NodeIndex node, float f, int g)
+    {
+      if (node >= where.size())
+        where.resize(node + 1);
+      heap.push_back(Entry{node, f, g});
+      where[node] = heap.size() - 1;
+      siftUp(heap.size() - 1);
+    }
+
+    // Moves a queued node to total cost f and path cost g
+    void update(NodeIndex node, float f, int g)
+    {
+      size_t i = where[node];
+      Entry old = heap[i];
+      heap[i].f = f;
+      heap[i].g = g;
+      if (before(heap[i], old))
+        siftUp(i);
+      else
+        siftDown(i);
+    }
+
+    // Removes and returns the node with the least f, then the greatest g
+    NodeIndex pop()
+    {
+      NodeIndex node = heap.front().node;
+      heap.front() = heap.back();
+      where[heap.front().node] = 0;
+      heap.pop_back();
+      if (!heap.empty())
+        siftDown(0);
+      return node;
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+  private:
+    struct Entry
+    {
+      NodeIndex node;  // queued node
+      float f;         // total cost of the node
+      int g;           // path cost of the node
+    };
+
+    // Returns true if entry e1 must leave the heap before entry e2
+    static bool before(const Entry& e1, const Entry& e2)
+    {
+      return e1.f < e2.f || (e1.f == e2.f && e1.g > e2.g);
+    }
+
+    // Moves the entry in slot i toward the root until its parent precedes it
+    void siftUp(size_t i)
+    {
+      Entry entry = heap[i];
+      while (i > 0 && before(entry, heap[(i - 1) / 2]))
+      {
+        heap[i] = heap[(i - 1) / 2];
+        where[heap[i].node] = i;
+        i = (i - 1) / 2;
+      }
+      heap[i] = entry;
+      where[entry.node] = i;
+    }
+
+    // Moves the entry in slot i toward the leaves until it precedes its children
+    void siftDown(size_t i)
+    {
+      Entry entry = heap[i];
+      for (size_t child = 2 * i + 1; child < heap.size(); child = 2 * i + 1)
+      {
+        if (child + 1 < heap.size() && before(heap[child + 1], heap[child]))
+          child++;
+        if (!before(heap[child], entry))
+          break;
+        heap[i] = heap[child];
+        where[heap[i].node] = i;
+        i = child;
+      }
+      heap[i] = entry;
+      where[entry.node] = i;
+    }
+
+    std::vector<Entry> heap;       // binary min-heap of queued nodes
+    std::vector<uint32_t> where;   // heap slot of every queued node, indexed by node
+};
+
+#endif // OPENLIST_H
@@ -0,0 +1,768 @@
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include "pdb.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+namespace
+{
+  const char MAGIC[4] = {'N', 'P', 'D', 'B'};  // first bytes of every database file
+  const size_t BATCH = 64;                      // successors whose entries are fetched together
+  const size_t CHUNK = 1 << 14;                 // states claimed at once by a building thread
+
+  // Returns the index of the lowest set bit of a nonzero mask
+  int lowestSquare(uint16_t mask)
+  {
+    return bitset<16>((mask & -mask) - 1).count();
+  }
+
+  // Hints to the processor that the given address will be read soon
+  void prefetch(const void* address)
+  {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#endif
+  }
+
+  // Copies a field of a file's header into a variable, advancing the position past it;
+  // returns false if the file ends first
+  template <typename T>
+  bool readField(const uint8_t* bytes, size_t size, size_t& position, T& field)
+  {
+    if (size - position < sizeof(field))
+      return false;
+    memcpy(&field, bytes + position, sizeof(field));
+    position += sizeof(field);
+    return true;
+  }
+
+  // Returns the 64-bit FNV-1a hash of a block of bytes
+  uint64_t fnv1a(const uint8_t* bytes, size_t count)
+  {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < count; ++i)
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    return hash;
+  }
+
+  // Masks of the squares of a board, used to move whole sets of squares at once
+  struct BoardMasks
+  {
+    int cols;             // number of columns of the board
+    uint16_t all;         // every square
+    uint16_t notLastCol;  // squares with a neighbor to the right
+    uint16_t notFirstCol; // squares with a neighbor to the left
+  };
+
+  // Returns the squares of the region of free squares connected to the given square,
+  // growing the region by one step in every direction at a time
+  uint16_t flood(int square, uint16_t freeSquares, const BoardMasks& masks)
+  {
+    uint16_t region = 1 << square;  // squares reached so far
+    uint16_t grown = region;        // squares reached after one more step
+
+    do
+    {
+      region = grown;
+      grown = region | (region << masks.cols) | (region >> masks.cols) |
+              ((region & masks.notLastCol) << 1) | ((region & masks.notFirstCol) >> 1);
+      grown &= freeSquares | region;
+    } while (grown != region);
+
+    return region;
+  }
+
+  // A search state generated by the breadth-first search whose placement's
+  // entry has not been checked yet
+  struct Successor
+  {
+    uint64_t rank;         // rank of the placement
+    uint64_t state;        // packed state (see PatternDatabase::build)
+    uint16_t freeSquares;  // squares not holding a pattern tile
+  };
+}
+
+string AdditivePatternDatabase::directory = "pdb";
+bool AdditivePatternDatabase::verification = true;
+
+/*********************************************************************
+ *
+ * PatternDatabase::PatternDatabase - Constructor
+ *
+ *--------------------------------------------------------------------
+ * Creates an empty database with no pattern.
+ *********************************************************************/
+PatternDatabase::PatternDatabase()
+  : nRows(0), nCols(0), distance(), entryEncoding(Encoding::BYTES), ranksPerEntry(1),
+    entries(nullptr), count(0) {}
+
+/*********************************************************************
+ *
+ * PatternDatabase::build - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Builds the database of a pattern by a breadth-first search over
+ * the placements of the pattern tiles, starting from the goal.
+ *
+ * A search state is a placement together with the region of free
+ * squares that holds the blank: moving the blank within its region
+ * moves no pattern tile and costs nothing, so every blank square of
+ * a region is equivalent. A state's successors slide a pattern tile
+ * next to the region into the region, at a cost of one move, leaving
+ * the blank on the square the tile left. For every placement, a mask
+ * records the squares of the regions already reached, so each state
+ * is queued once, and the cost of a placement is the depth at which
+ * any of its regions is first reached.
+ *
+ * Queued states are packed in 64 bits, with the blank's square in
+ * bits 0 to 3 and the square of pattern tile j in bits 4j+4 to 4j+7,
+ * so expanding a state needs no unranking. Sliding tile j changes
+ * its own Lehmer digit by the distance it moves, less one for every
+ * earlier pattern tile it passes, and the digit of every later tile
+ * it passes by one, so a successor's rank is the state's rank plus
+ * a few precomputed digit weights. Successors are ranked in batches
+ * whose entries are prefetched before any of them is checked, since
+ * the entries of large databases are spread over far more memory
+ * than the caches hold.
+ *
+ * Each depth is expanded by several threads, which claim chunks of
+ * the depth's states in turn and queue the states they reach in
+ * vectors of their own. A placement's mask is updated with an atomic
+ * OR, and the thread whose OR first sets the bits of a region queues
+ * that state, so every state is still queued exactly once. The thread
+ * that first sets any bit of a placement's mask writes its cost; no
+ * other thread writes that entry. Which thread reaches a state first
+ * varies from run to run, but the depth at which it is reached does
+ * not, so the database does not depend on the number of threads.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   int rows: number of rows of the board
+ *   int cols: number of columns of the board
+ *   const vector<int>& tiles: distinct tile numbers of the pattern
+ *   ostream* log: stream receiving one progress line per depth, or
+ *                 nullptr for none
+ *   int threads: number of threads expanding each depth, or 0 for
+ *                one per hardware thread
+ * RETURNS
+ *   The complete database of the pattern.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws invalid_argument if the board has more than 16 squares or
+ *   if the pattern holds an invalid or repeated tile number.
+ *********************************************************************/
+PatternDatabase PatternDatabase::build(int rows, int cols, const vector<int>& tiles, ostream* log,
+                                       int threads)
+{
+  int len = rows * cols;  // number of squares
+  int k = tiles.size();   // number of pattern tiles
+
+  if (rows < 2 || cols < 2 || len > 16)
+    throw invalid_argument("PatternDatabase: boards must have from 4 to 16 squares");
+  uint16_t patternMask = 0;  // mask of the pattern's tile numbers
+  for (int tile : tiles)
+  {
+    if (tile < 1 || tile >= len || (patternMask >> tile) & 1)
+      throw invalid_argument("PatternDatabase: invalid or repeated pattern tile");
+    patternMask |= 1 << tile;
+  }
+
+  PatternDatabase pdb;
+  pdb.setPattern(rows, cols, tiles);
+  vector<uint8_t> costs(lehmerCount(k, len), UNKNOWN);  // cost of every placement
+
+  // Squares next to each square, and masks of the board's squares
+  uint16_t adjacent[16] = {};
+  BoardMasks masks = {cols, uint16_t((1 << len) - 1), 0, 0};
+  for (int i = 0; i < len; ++i)
+  {
+    if (i >= cols)
+      adjacent[i] |= 1 << (i - cols);
+    if (i + cols < len)
+      adjacent[i] |= 1 << (i + cols);
+    if (i % cols > 0)
+    {
+      adjacent[i] |= 1 << (i - 1);
+      masks.notFirstCol |= 1 << i;
+    }
+    if (i % cols < cols - 1)
+    {
+      adjacent[i] |= 1 << (i + 1);
+      masks.notLastCol |= 1 << i;
+    }
+  }
+
+  // Change of rank per unit change of each pattern tile's Lehmer digit
+  int64_t weight[16];
+  weight[k - 1] = 1;
+  for (int j = k - 2; j >= 0; --j)
+    weight[j] = weight[j + 1] * (len - 1 - j);
+
+  if (threads <= 0)
+    threads = max(1u, thread::hardware_concurrency());
+
+  uint16_t allSquares = masks.all;                // mask of every square
+  unique_ptr<atomic<uint16_t>[]> seen(            // squares of the regions reached, per placement
+      new atomic<uint16_t>[costs.size()]());
+  vector<vector<uint64_t>> layer(threads);        // packed states of the current depth, per thread
+  vector<vector<uint64_t>> next(threads);         // packed states of the next depth, per thread
+  vector<uint64_t> reachedBy(threads, 0);         // placements first reached by each thread
+  uint64_t reached = 1;                           // number of placements reached
+  int squares[16];                                // squares of the pattern tiles
+
+  // The goal placement holds tile t on square t - 1, with the blank on the last square
+  uint16_t occupied = 0;
+  uint64_t goalState = len - 1;
+  for (int j = 0; j < k; ++j)
+  {
+    squares[j] = tiles[j] - 1;
+    occupied |= 1 << squares[j];
+    goalState |= uint64_t(squares[j]) << (4 * j + 4);
+  }
+  uint64_t goalRank = lehmerRank(squares, k, len);
+  seen[goalRank] = flood(len - 1, allSquares & ~occupied, masks);
+  costs[goalRank] = 0;
+  layer[0].push_back(goalState);
+
+  for (int depth = 0; ; ++depth)
+  {
+    // Split the layer into chunks that the threads claim in turn
+    vector<pair<int, size_t>> chunks;  // thread vector and first state of every chunk
+    size_t layerSize = 0;              // number of states of the layer
+    for (int t = 0; t < threads; ++t)
+    {
+      for (size_t first = 0; first < layer[t].size(); first += CHUNK)
+        chunks.emplace_back(t, first);
+      layerSize += layer[t].size();
+    }
+    if (layerSize == 0)
+      break;
+    if (log)
+      *log << "depth " << depth << ": " << layerSize << " states, "
+           << reached << " of " << costs.size() << " placements reached" << endl;
+
+    atomic<size_t> nextChunk(0);  // index of the next chunk to claim
+
+    // Expands the chunks claimed by thread t into next[t]
+    auto expand = [&](int t)
+    {
+      Successor batch[BATCH + 4 * 16];  // successors awaiting their entries
+      size_t batchSize = 0;             // number of successors in the batch
+      int squares[16];                  // squares of the pattern tiles
+
+      // Queues the successors of the batch whose regions have not been reached yet.
+      // Regions of a placement are disjoint, so exactly one thread sees a region's
+      // bit clear in the mask that its fetch_or replaces, and queues the state.
+      auto checkBatch = [&]()
+      {
+        for (size_t b = 0; b < batchSize; ++b)
+        {
+          const Successor& successor = batch[b];
+          int blank = successor.state & 0xF;
+          atomic<uint16_t>& mask = seen[successor.rank];
+          if ((mask.load(memory_order_relaxed) >> blank) & 1)
+            continue;
+
+          uint16_t region = flood(blank, successor.freeSquares, masks);
+          uint16_t old = mask.fetch_or(region, memory_order_relaxed);
+          if ((old >> blank) & 1)
+            continue;
+          if (old == 0)
+          {
+            costs[successor.rank] = depth + 1;
+            reachedBy[t]++;
+          }
+          next[t].push_back(successor.state);
+        }
+        batchSize = 0;
+      };
+
+      for (size_t c = nextChunk++; c < chunks.size(); c = nextChunk++)
+      {
+        const vector<uint64_t>& states = layer[chunks[c].first];
+        size_t last = min(chunks[c].second + CHUNK, states.size());
+        for (size_t s = chunks[c].second; s < last; ++s)
+        {
+          uint64_t state = states[s];
+          int tileOn[16];  // pattern tile on each square, or -1
+          fill(tileOn, tileOn + 16, -1);
+          uint16_t occupied = 0;
+          for (int j = 0; j < k; ++j)
+          {
+            squares[j] = (state >> (4 * j + 4)) & 0xF;
+            tileOn[squares[j]] = j;
+            occupied |= 1 << squares[j];
+          }
+          uint64_t rank = lehmerRank(squares, k, len);
+          uint16_t region = flood(state & 0xF, allSquares & ~occupied, masks);
+
+          // Slide each pattern tile next to the blank's region into the region
+          for (int j = 0; j < k; ++j)
+          {
+            int from = squares[j];
+            for (uint16_t targets = adjacent[from] & region; targets != 0; targets &= targets - 1)
+            {
+              int to = lowestSquare(targets);
+              int step = to > from ? 1 : -1;
+              int64_t change = (to - from) * weight[j];
+              for (int passed = from + step; passed != to; passed += step)
+              {
+                int i = tileOn[passed];
+                if (i >= 0)
+                  change += i < j ? -step * weight[j] : step * weight[i];
+              }
+
+              Successor& successor = batch[batchSize++];
+              successor.rank = rank + change;
+              successor.state = (state & ~uint64_t(0xF) & ~(uint64_t(0xF) << (4 * j + 4))) |
+                                uint64_t(to) << (4 * j + 4) | from;
+              successor.freeSquares = (allSquares & ~occupied & ~(1 << to)) | (1 << from);
+              ::prefetch(&seen[successor.rank]);
+            }
+          }
+
+          if (batchSize >= BATCH)
+            checkBatch();
+        }
+      }
+      checkBatch();
+    };
+
+    vector<thread> workers;
+    for (int t = 1; t < threads; ++t)
+      workers.emplace_back(expand, t);
+    expand(0);
+    for (thread& worker : workers)
+      worker.join();
+
+    for (int t = 0; t < threads; ++t)
+    {
+      reached += reachedBy[t];
+      reachedBy[t] = 0;
+      layer[t].swap(next[t]);
+      next[t].clear();
+    }
+  }
+
+  auto owned = make_shared<vector<uint8_t>>(move(costs));
+  pdb.entries = owned->data();
+  pdb.count = owned->size();
+  pdb.storage = owned;
+  return pdb;
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::compress - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Returns a compressed copy of an uncompressed database (see the
+ * class description). Ranks are visited in order, a run of ranks
+ * at a time that differ only in the square of the last pattern tile,
+ * so that the Manhattan distance of each placement is updated rather
+ * than recomputed.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   Encoding encoding: how the entries of the copy are stored
+ *   int blockSize: number of consecutive ranks sharing each entry of
+ *                  the copy, whose cost is their minimum
+ * RETURNS
+ *   The compressed database.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws invalid_argument if the database is already compressed or
+ *   if the block size is not positive.
+ *********************************************************************/
+PatternDatabase PatternDatabase::compress(Encoding encoding, int blockSize) const
+{
+  if (entryEncoding != Encoding::BYTES || ranksPerEntry != 1)
+    throw invalid_argument("PatternDatabase: the database is already compressed");
+  if (blockSize < 1)
+    throw invalid_argument("PatternDatabase: block sizes must be positive");
+
+  int len = nRows * nCols;          // number of squares
+  int k = patternTiles.size();      // number of pattern tiles
+  uint64_t blocks = (count + blockSize - 1) / blockSize;  // number of entries of the copy
+  vector<uint8_t> least(blocks, UNKNOWN);  // least value stored for the ranks of each entry
+  int squares[16];                  // squares of the pattern tiles
+
+  // Ranks that differ only in their last Lehmer digit place the last tile on
+  // each square left by the others, in increasing order
+  for (uint64_t first = 0; first < count; first += len - k + 1)
+  {
+    lehmerUnrank(first, k, len, squares);
+    int manhattan = 0;                        // distance of all but the last tile
+    uint16_t freeSquares = (1 << len) - 1;    // squares left for the last tile
+    for (int j = 0; j < k - 1; ++j)
+    {
+      manhattan += distance[j][squares[j]];
+      freeSquares &= ~(1 << squares[j]);
+    }
+
+    uint64_t rank = first;
+    for (uint16_t rest = freeSquares; rest != 0; rest &= rest - 1, ++rank)
+    {
+      int value = entries[rank];
+      if (encoding == Encoding::MANHATTAN_DELTAS)
+        value = min((value - manhattan - distance[k - 1][lowestSquare(rest)]) / 2, 15);
+      uint8_t& entry = least[rank / blockSize];
+      if (value < entry)
+        entry = value;
+    }
+  }
+
+  PatternDatabase packed;
+  packed.setPattern(nRows, nCols, patternTiles);
+  packed.entryEncoding = encoding;
+  packed.ranksPerEntry = blockSize;
+  packed.count = count;
+  if (encoding == Encoding::MANHATTAN_DELTAS)
+  {
+    // Two entries per byte, the entry of the even index in the low 4 bits
+    vector<uint8_t> nibbles((blocks + 1) / 2, 0);
+    for (uint64_t index = 0; index < blocks; ++index)
+      nibbles[index / 2] |= least[index] << (index % 2 * 4);
+    least.swap(nibbles);
+  }
+
+  auto owned = make_shared<vector<uint8_t>>(move(least));
+  packed.entries = owned->data();
+  packed.storage = owned;
+  return packed;
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::memoryUsage - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Returns the number of bytes of the stored entries.
+ *********************************************************************/
+size_t PatternDatabase::memoryUsage() const
+{
+  size_t stored = (count + ranksPerEntry - 1) / ranksPerEntry;  // number of stored entries
+  return entryEncoding == Encoding::BYTES ? stored : (stored + 1) / 2;
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::load - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Opens a database written by save, checking its format version and
+ * its size. Files of version 1, which had no encoding fields, hold
+ * uncompressed databases. Where the system supports it, the file is mapped into
+ * memory read-only and its entries are used in place, so loading
+ * reads only the header and the entries are paged in as lookups
+ * reach them; elsewhere, the file is read into memory.
+ *
+ * Verifying the checksum of the entries reads the whole file, so
+ * callers that need a database at once, and trust its file, may skip
+ * it.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const string& path: path of the database file
+ *   bool verify: true to check the entries against their checksum
+ * RETURNS
+ *   The database stored in the file.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws runtime_error if the file cannot be read, is not a
+ *   database file of the current format version, has the wrong size
+ *   or, when verified, is corrupted.
+ *********************************************************************/
+PatternDatabase PatternDatabase::load(const string& path, bool verify)
+{
+  PatternDatabase pdb;
+  const uint8_t* bytes;  // contents of the file
+  size_t fileSize = 0;   // size of the file in bytes
+
+#if defined(__unix__) || defined(__APPLE__)
+  int file = open(path.c_str(), O_RDONLY);
+  if (file < 0)
+    throw runtime_error("PatternDatabase: cannot open " + path);
+  struct stat info;
+  void* address = MAP_FAILED;
+  if (fstat(file, &info) == 0 && info.st_size > 0)
+  {
+    fileSize = info.st_size;
+    address = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file, 0);
+  }
+  close(file);
+  if (address == MAP_FAILED)
+    throw runtime_error("PatternDatabase: cannot map " + path);
+
+  // Start reading the file in the background, since lookups will touch all of it
+  madvise(address, fileSize, MADV_WILLNEED);
+  pdb.storage = shared_ptr<const void>(address, [fileSize](const void* mapped)
+                                       { munmap(const_cast<void*>(mapped), fileSize); });
+  bytes = static_cast<const uint8_t*>(address);
+#else
+  ifstream in(path, ios::binary);
+  if (!in)
+    throw runtime_error("PatternDatabase: cannot open " + path);
+  auto contents = make_shared<vector<uint8_t>>(istreambuf_iterator<char>(in),
+                                               istreambuf_iterator<char>());
+  pdb.storage = contents;
+  bytes = contents->data();
+  fileSize = contents->size();
+#endif
+
+  char magic[4];
+  uint32_t version;
+  int32_t header[3];  // rows, columns and number of pattern tiles
+  size_t position = 0;
+  if (!readField(bytes, fileSize, position, magic) || !equal(magic, magic + 4, MAGIC) ||
+      !readField(bytes, fileSize, position, version) ||
+      !readField(bytes, fileSize, position, header) || header[0] < 2 || header[1] < 2 ||
+      header[0] * header[1] > 16 || header[2] < 1 || header[2] >= header[0] * header[1])
+    throw runtime_error("PatternDatabase: " + path + " is not a pattern database file");
+  if (version != 1 && version != FORMAT_VERSION)
+    throw runtime_error("PatternDatabase: " + path + " has unknown format version " +
+                        to_string(version));
+
+  vector<int32_t> tiles(header[2]);
+  uint32_t encoding = 0;   // how the entries are stored (version 2)
+  uint32_t blockSize = 1;  // ranks sharing each entry (version 2)
+  uint64_t count;          // number of placements
+  uint64_t checksum;       // FNV-1a hash of the stored entries
+  for (int32_t& tile : tiles)
+  {
+    if (!readField(bytes, fileSize, position, tile) || tile < 1 || tile >= header[0] * header[1])
+      throw runtime_error("PatternDatabase: " + path + " is not a pattern database file");
+  }
+  if (version >= 2 && (!readField(bytes, fileSize, position, encoding) ||
+                       !readField(bytes, fileSize, position, blockSize) ||
+                       encoding > uint32_t(Encoding::MANHATTAN_DELTAS) || blockSize < 1))
+    throw runtime_error("PatternDatabase: " + path + " has an unknown encoding");
+
+  pdb.setPattern(header[0], header[1], vector<int>(tiles.begin(), tiles.end()));
+  pdb.entryEncoding = Encoding(encoding);
+  pdb.ranksPerEntry = blockSize;
+  if (!readField(bytes, fileSize, position, count) ||
+      !readField(bytes, fileSize, position, checksum) ||
+      count != lehmerCount(header[2], header[0] * header[1]))
+    throw runtime_error("PatternDatabase: " + path + " has the wrong number of entries");
+  pdb.count = count;
+  if (fileSize - position != pdb.memoryUsage())
+    throw runtime_error("PatternDatabase: " + path + " has the wrong number of entries");
+
+  pdb.entries = bytes + position;
+  if (verify && fnv1a(pdb.entries, pdb.memoryUsage()) != checksum)
+    throw runtime_error("PatternDatabase: " + path + " is corrupted (checksum mismatch)");
+
+  return pdb;
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::save - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Writes the database to a file, with every field in native byte
+ * order: the characters "NPDB", the format version as a 32-bit
+ * unsigned integer, the number of rows, columns and pattern tiles and
+ * the pattern tile numbers as 32-bit integers, the encoding and the
+ * block size as 32-bit unsigned integers, the number of placements
+ * and the 64-bit FNV-1a hash of the stored entries as 64-bit
+ * unsigned integers, then the stored entries in rank order.
+ *
+ * Solvers map database files shared while they run, so the file is
+ * never rewritten in place: the database is written to a temporary
+ * file next to it, which is then renamed over it, and a running
+ * solver keeps the old file until it unmaps it.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const string& path: path of the database file
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws runtime_error if the file cannot be written, leaving any
+ *   previous file at the path unchanged.
+ *********************************************************************/
+void PatternDatabase::save(const string& path) const
+{
+  string temporary = path + ".tmp";  // file written before replacing the database
+  ofstream out(temporary, ios::binary);
+  uint32_t version = FORMAT_VERSION;
+  int32_t header[3] = {nRows, nCols, (int32_t)patternTiles.size()};
+  vector<int32_t> tiles(patternTiles.begin(), patternTiles.end());
+  uint32_t encoding[2] = {uint32_t(entryEncoding), uint32_t(ranksPerEntry)};
+  uint64_t placements = count;
+  uint64_t checksum = fnv1a(entries, memoryUsage());
+
+  out.write(MAGIC, sizeof(MAGIC));
+  out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  out.write(reinterpret_cast<const char*>(header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(tiles.data()), tiles.size() * sizeof(int32_t));
+  out.write(reinterpret_cast<const char*>(encoding), sizeof(encoding));
+  out.write(reinterpret_cast<const char*>(&placements), sizeof(placements));
+  out.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+  out.write(reinterpret_cast<const char*>(entries), memoryUsage());
+  out.close();
+
+  error_code error;  // error of the rename, or of removing the temporary file
+  if (out)
+    filesystem::rename(temporary, path, error);
+  if (!out || error)
+  {
+    filesystem::remove(temporary, error);
+    throw runtime_error("PatternDatabase: cannot write " + path);
+  }
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::fileName - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Returns the file name under which the database of a pattern is
+ * stored, such as "4x4-2-3-4.pdb".
+ *********************************************************************/
+string PatternDatabase::fileName(int rows, int cols, const vector<int>& tiles)
+{
+  string name = to_string(rows) + "x" + to_string(cols);
+  for (int tile : tiles)
+    name += "-" + to_string(tile);
+  return name + ".pdb";
+}
+
+/*********************************************************************
+ *
+ * PatternDatabase::setPattern - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Sets the board and pattern of the database and the Manhattan
+ * distance of every pattern tile on every square.
+ *********************************************************************/
+void PatternDatabase::setPattern(int rows, int cols, const vector<int>& tiles)
+{
+  nRows = rows;
+  nCols = cols;
+  patternTiles = tiles;
+  for (size_t j = 0; j < tiles.size(); ++j)
+  {
+    int goal = tiles[j] - 1;  // goal square of the tile
+    for (int i = 0; i < rows * cols; ++i)
+      distance[j][i] = abs(i / cols - goal / cols) + abs(i % cols - goal % cols);
+  }
+}
+
+/*********************************************************************
+ *
+ * AdditivePatternDatabase::get - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Returns the additive database of a partition of the tiles. The
+ * first call for a partition loads each pattern's database from the
+ * database directory; later calls with the same directory and
+ * verification setting return the same databases.
+ * Databases are never built here: the pdbgen program builds them
+ * ahead of time. Each file's entries are checked against its checksum
+ * before they are used, which reads the whole file once per process
+ * (about a second for the 7-8 databases); setVerification(false)
+ * skips the check for trusted files, leaving only the header and size
+ * checks.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   int rows: number of rows of the board
+ *   int cols: number of columns of the board
+ *   const vector<vector<int>>& partition: disjoint patterns of tiles
+ * RETURNS
+ *   The additive database of the partition.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws runtime_error if a database file is missing, cannot be
+ *   loaded or is corrupted, or if it holds the database of another
+ *   pattern.
+ *********************************************************************/
+const AdditivePatternDatabase& AdditivePatternDatabase::get(int rows, int cols,
+                                                            const vector<vector<int>>& partition)
+{
+  static map<string, AdditivePatternDatabase> loaded;  // databases by source and partition
+
+  // Databases are cached by the directory they were loaded from and whether their
+  // checksums were verified, so changing either setting loads the files again
+  error_code error;  // error resolving the directory, which is then used as given
+  filesystem::path source = filesystem::weakly_canonical(directory, error);
+  string key = (error ? directory : source.string()) + (verification ? " verified " : " ");
+  for (const vector<int>& tiles : partition)
+    key += PatternDatabase::fileName(rows, cols, tiles) + " ";
+
+  auto found = loaded.find(key);
+  if (found != loaded.end())
+    return found->second;
+
+  AdditivePatternDatabase additive;
+  for (const vector<int>& tiles : partition)
+  {
+    string path = directory + "/" + PatternDatabase::fileName(rows, cols, tiles);
+    if (!filesystem::exists(path))
+      throw runtime_error("PatternDatabase: " + path + " does not exist; build it with pdbgen");
+
+    additive.parts.push_back(PatternDatabase::load(path, verification));
+    const PatternDatabase& part = additive.parts.back();
+    if (part.rows() != rows || part.cols() != cols || part.tiles() != tiles)
+      throw runtime_error("PatternDatabase: " + path + " holds the database of another pattern");
+  }
+
+  return loaded[key] = move(additive);
+}
+
+/*********************************************************************
+ *
+ * AdditivePatternDatabase::memoryUsage - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Returns the number of bytes of the stored entries of every
+ * database of the partition.
+ *********************************************************************/
+size_t AdditivePatternDatabase::memoryUsage() const
+{
+  size_t total = 0;
+  for (const PatternDatabase& part : parts)
+    total += part.memoryUsage();
+  return total;
+}
+
+/*********************************************************************
+ *
+ * AdditivePatternDatabase::setDirectory - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Sets the directory that database files are loaded from ("pdb" by
+ * default). Databases already loaded from another directory stay
+ * valid but are no longer returned by get().
+ *********************************************************************/
+void AdditivePatternDatabase::setDirectory(const string& path)
+{
+  directory = path;
+}
+
+/*********************************************************************
+ *
+ * AdditivePatternDatabase::setVerification - Public Static Method
+ *
+ *--------------------------------------------------------------------
+ * Sets whether database files are checked against their checksums
+ * when they are loaded (true by default). Databases loaded with the
+ * other setting stay valid but are no longer returned by get().
+ *********************************************************************/
+void AdditivePatternDatabase::setVerification(bool verify)
+{
+  verification = verify;
+}
@@ -0,0 +1,230 @@
+#ifndef PDB_H
+#define PDB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+#include "permutation.h"
+
+/*********************************************************************
+ *
+ * PDB
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class PatternDatabase: exact move counts of a subset of the tiles
+ *   class AdditivePatternDatabase: sum over a disjoint tile partition
+ *   PARTITION_663, PARTITION_78: standard 15-puzzle tile partitions
+ *********************************************************************/
+
+/*********************************************************************
+ * PatternDatabase Class
+ *   Stores, for every placement of a pattern of tiles on a Rows x Cols
+ *   board, the minimum number of moves of pattern tiles needed to
+ *   bring them to their goal squares, with the other tiles treated as
+ *   indistinguishable and moves of them counted as free. Because only
+ *   pattern tiles are counted, the costs of databases over disjoint
+ *   patterns can be added without overestimating.
+ *
+ *   A placement is indexed by the lehmerRank of the squares of the
+ *   pattern tiles, in the order the tiles are listed, so a pattern of
+ *   k tiles on n squares has n! / (n-k)! entries of one byte each.
+ *   The blank's position is not part of the index: each entry is the
+ *   minimum over every position of the blank. The costs are therefore
+ *   admissible but not consistent: between neighboring states a cost
+ *   can drop by more than one move.
+ *
+ *   A database can be compressed to fit more of it in the caches, in
+ *   two ways that keep its costs admissible and can be combined:
+ *   - Min-compression: one entry holds the minimum cost of a block of
+ *     consecutive ranks, which share the squares of all but the last
+ *     pattern tile when the block size divides the number of squares
+ *     left for that tile.
+ *   - Manhattan deltas: a cost is at least the Manhattan distance of
+ *     the pattern tiles and differs from it by an even number, since
+ *     every move changes that distance by one, so an entry can hold
+ *     half the difference in 4 bits (costs whose difference exceeds 30
+ *     are lowered to 30) and a lookup adds back the distance.
+ *
+ *   Databases are built by a breadth-first search from the goal
+ *   placement, normally ahead of time by the pdbgen program, and
+ *   stored on disk as a versioned header with a checksum of the
+ *   entries, followed by the entries in rank order. Loading maps the
+ *   file read-only into memory where the system supports it, so the
+ *   entries are used in place, and every process using the same file
+ *   shares one copy of it in the page cache. Copies of a database
+ *   share its entries.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   Boards must not exceed 16 squares.
+ *********************************************************************/
+class PatternDatabase
+{
+  public:
+    static constexpr uint8_t UNKNOWN = 0xFF;        // cost of a placement not yet reached
+    static constexpr uint32_t FORMAT_VERSION = 2;   // version of the database file format
+
+    // Ways of storing the entries
+    enum class Encoding : uint32_t
+    {
+      BYTES = 0,             // one byte per entry holding the cost
+      MANHATTAN_DELTAS = 1   // 4 bits per entry holding half the cost's excess over
+                             // the Manhattan distance of the pattern tiles
+    };
+
+    // CONSTRUCTOR
+    PatternDatabase();
+
+    // PUBLIC METHODS
+    static PatternDatabase build(int rows, int cols, const std::vector<int>& tiles,
+                                 std::ostream* log = nullptr, int threads = 1);
+    static PatternDatabase load(const std::string& path, bool verify = true);
+    PatternDatabase compress(Encoding encoding, int blockSize) const;
+    void save(const std::string& path) const;
+    static std::string fileName(int rows, int cols, const std::vector<int>& tiles);
+
+    int rows() const { return nRows; }
+    int cols() const { return nCols; }
+    const std::vector<int>& tiles() const { return patternTiles; }
+    size_t size() const { return count; }
+    Encoding encoding() const { return entryEncoding; }
+    int blockSize() const { return ranksPerEntry; }
+    size_t memoryUsage() const;
+
+    // Where the cost of a placement is stored, as found by locate
+    struct Entry
+    {
+      uint64_t index;  // index of the entry, in entries of the database's encoding
+      int manhattan;   // Manhattan distance of the pattern tiles
+    };
+
+    // Returns where the cost of the placement given by the square of every tile
+    // number is stored
+    Entry locate(const int* squareOf) const
+    {
+      int squares[16];    // squares of the pattern tiles, in pattern order
+      int manhattan = 0;  // Manhattan distance of the pattern tiles
+      for (size_t j = 0; j < patternTiles.size(); ++j)
+      {
+        squares[j] = squareOf[patternTiles[j]];
+        manhattan += distance[j][squares[j]];
+      }
+
+      uint64_t index = lehmerRank(squares, patternTiles.size(), nRows * nCols);
+      if (ranksPerEntry > 1)
+        index /= ranksPerEntry;
+      return Entry{index, manhattan};
+    }
+
+    // Hints to the processor that the given entry will be read soon, so that several
+    // lookups can wait for memory at the same time
+    void prefetch(const Entry& entry) const
+    {
+#if defined(__GNUC__)
+      __builtin_prefetch(entries + (entryEncoding == Encoding::BYTES ? entry.index : entry.index / 2));
+#endif
+    }
+
+    // Returns the cost stored in the given entry
+    int cost(const Entry& entry) const
+    {
+      if (entryEncoding == Encoding::BYTES)
+        return entries[entry.index];
+      return entry.manhattan + 2 * ((entries[entry.index / 2] >> (entry.index % 2 * 4)) & 0xF);
+    }
+
+    // Returns the cost of the placement given by the square of every tile number
+    int cost(const int* squareOf) const
+    {
+      return cost(locate(squareOf));
+    }
+
+  private:
+    // ATTRIBUTES
+    int nRows;                            // number of rows of the board
+    int nCols;                            // number of columns of the board
+    std::vector<int> patternTiles;        // tile numbers of the pattern
+    uint8_t distance[16][16];             // Manhattan distance of pattern tile j on square i
+    Encoding entryEncoding;               // how the entries are stored
+    int ranksPerEntry;                    // ranks sharing each entry (min-compression)
+    std::shared_ptr<const void> storage;  // owner of the entries: a vector or a file mapping
+    const uint8_t* entries;               // stored entries, indexed by rank / ranksPerEntry
+    size_t count;                         // number of placements
+
+    // PRIVATE METHODS
+    void setPattern(int rows, int cols, const std::vector<int>& tiles);
+};
+
+/*********************************************************************
+ * AdditivePatternDatabase Class
+ *   Combines pattern databases over disjoint sets of tiles by adding
+ *   their costs. Databases are loaded from a directory of database
+ *   files written by the pdbgen program; each partition is loaded
+ *   once per process, and its files are checked against their
+ *   checksums unless verification has been turned off.
+ *********************************************************************/
+class AdditivePatternDatabase
+{
+  public:
+    // PUBLIC METHODS
+    static const AdditivePatternDatabase& get(int rows, int cols,
+                                              const std::vector<std::vector<int>>& partition);
+    static void setDirectory(const std::string& path);
+    static void setVerification(bool verify);
+    size_t memoryUsage() const;
+
+    static constexpr int MAX_BATCH = 8;   // most placements looked up together
+    static constexpr int MAX_PARTS = 16;  // most databases of a partition
+
+    // Returns the sum of the costs of the placement given by the square of every tile number
+    int cost(const int* squareOf) const
+    {
+      int total = 0;
+      for (const PatternDatabase& part : parts)
+        total += part.cost(squareOf);
+      return total;
+    }
+
+    // Sets the sum of the costs of each of count placements, given by the square of
+    // every tile number, in totals. Every entry is located and prefetched before any
+    // is read, so the cache misses of the lookups overlap instead of following each
+    // other; count must not exceed MAX_BATCH
+    void costs(const int* const squareOf[], int count, int totals[]) const
+    {
+      PatternDatabase::Entry located[MAX_PARTS * MAX_BATCH];  // entries by part, then placement
+
+      for (size_t p = 0; p < parts.size(); ++p)
+      {
+        for (int i = 0; i < count; ++i)
+        {
+          located[p * MAX_BATCH + i] = parts[p].locate(squareOf[i]);
+          parts[p].prefetch(located[p * MAX_BATCH + i]);
+        }
+      }
+
+      for (int i = 0; i < count; ++i)
+      {
+        totals[i] = 0;
+        for (size_t p = 0; p < parts.size(); ++p)
+          totals[i] += parts[p].cost(located[p * MAX_BATCH + i]);
+      }
+    }
+
+  private:
+    // ATTRIBUTES
+    std::vector<PatternDatabase> parts;  // databases of the disjoint patterns
+    static std::string directory;        // directory holding database files
+    static bool verification;            // true to check files against their checksums
+};
+
+// Korf and Felner's partitions of the 15-puzzle tiles into disjoint patterns
+const std::vector<std::vector<int>> PARTITION_663 = {{1, 5, 6, 9, 10, 13},
+                                                     {7, 8, 11, 12, 14, 15},
+                                                     {2, 3, 4}};
+const std::vector<std::vector<int>> PARTITION_78 = {{1, 2, 3, 4, 5, 6, 7},
+                                                    {8, 9, 10, 11, 12, 13, 14, 15}};
+
+#endif // PDB_H
@@ -0,0 +1,193 @@
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "pdb.h"
+using namespace std;
+
+// Prints how to run the program
+void printUsage() {
+  cerr << "Usage: pdbgen [-j THREADS] [-z] [-b BLOCK] [-i INPUT_DIRECTORY]" << endl;
+  cerr << "              ROWSxCOLS PARTITION [OUTPUT_DIRECTORY]" << endl;
+  cerr << "       pdbgen --verify FILE..." << endl;
+  cerr << endl;
+  cerr << "Builds the pattern database of every pattern of a partition of the" << endl;
+  cerr << "tiles and writes them to OUTPUT_DIRECTORY (\"pdb\" by default)." << endl;
+  cerr << "PARTITION lists patterns separated by '/', each a list of tile" << endl;
+  cerr << "numbers separated by ',', such as 1,2,3,4,5,6,7/8,9,10,11,12,13,14,15." << endl;
+  cerr << "On 4x4 boards, \"663\" and \"78\" name the standard partitions." << endl;
+  cerr << "Each database is built with THREADS threads (one per hardware" << endl;
+  cerr << "thread by default); the result does not depend on the number." << endl;
+  cerr << endl;
+  cerr << "Databases can be compressed to fit more of them in the caches:" << endl;
+  cerr << "  -z        store 4 bits per entry, relative to the Manhattan distance" << endl;
+  cerr << "  -b BLOCK  store the least cost of every BLOCK consecutive entries" << endl;
+  cerr << "  -i DIR    compress the uncompressed databases in DIR instead of" << endl;
+  cerr << "            building them" << endl;
+  cerr << endl;
+  cerr << "With --verify, checks the given database files against their checksums." << endl;
+}
+
+// Reads a partition from its command line form, returning false if it is malformed
+bool parsePartition(const string& text, vector<vector<int>>& partition) {
+  stringstream patterns(text);
+  string pattern;
+
+  while (getline(patterns, pattern, '/')) {
+    stringstream numbers(pattern);
+    string number;
+    partition.emplace_back();
+    while (getline(numbers, number, ',')) {
+      if (number.empty() || number.size() > 9 ||
+          number.find_first_not_of("0123456789") != string::npos)
+        return false;
+      partition.back().push_back(stoi(number));
+    }
+    if (partition.back().empty())
+      return false;
+  }
+
+  return !partition.empty();
+}
+
+// Reads a positive number from the command line, returning false if it is malformed
+bool parseCount(const string& text, int& count) {
+  if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != string::npos)
+    return false;
+  count = stoi(text);
+  return count > 0;
+}
+
+// Checks database files against their checksums, returning the number that fail
+int verifyFiles(const vector<string>& paths) {
+  int failed = 0;
+
+  for (const string& path : paths) {
+    try {
+      PatternDatabase pdb = PatternDatabase::load(path);
+      cout << path << ": OK (" << pdb.size() << " entries)" << endl;
+    }
+    catch (const exception& e) {
+      cerr << e.what() << endl;
+      failed++;
+    }
+  }
+
+  return failed;
+}
+
+int main(int argc, char* argv[]) {
+  vector<string> args(argv + 1, argv + argc);
+  int threads = 0;
+  int blockSize = 1;
+  PatternDatabase::Encoding encoding = PatternDatabase::Encoding::BYTES;
+  string inputDirectory = "";
+
+  if (args.size() >= 2 && args[0] == "--verify")
+    return verifyFiles(vector<string>(args.begin() + 1, args.end())) == 0 ? 0 : 1;
+
+  while (!args.empty() && args[0].size() == 2 && args[0][0] == '-') {
+    char option = args[0][1];
+    bool valid = true;
+    if (option == 'z') {
+      encoding = PatternDatabase::Encoding::MANHATTAN_DELTAS;
+      args.erase(args.begin());
+      continue;
+    }
+    if (args.size() < 2)
+      valid = false;
+    else if (option == 'j')
+      valid = parseCount(args[1], threads);
+    else if (option == 'b')
+      valid = parseCount(args[1], blockSize);
+    else if (option == 'i')
+      inputDirectory = args[1];
+    else
+      valid = false;
+    if (!valid) {
+      printUsage();
+      return 1;
+    }
+    args.erase(args.begin(), args.begin() + 2);
+  }
+  if (args.size() < 2 || args.size() > 3) {
+    printUsage();
+    return 1;
+  }
+
+  int rows = 0;
+  int cols = 0;
+  char separator = 0;
+  stringstream size(args[0]);
+  size >> rows >> separator >> cols;
+  if (!size || !size.eof() || separator != 'x') {
+    printUsage();
+    return 1;
+  }
+
+  string partitionName = args[1];
+  string directory = args.size() == 3 ? args[2] : "pdb";
+  vector<vector<int>> partition;
+  if (rows == 4 && cols == 4 && partitionName == "663") {
+    partition = PARTITION_663;
+  }
+  else if (rows == 4 && cols == 4 && partitionName == "78") {
+    partition = PARTITION_78;
+  }
+  else if (!parsePartition(partitionName, partition)) {
+    printUsage();
+    return 1;
+  }
+
+  // Patterns must be disjoint for their costs to be added
+  vector<bool> used(rows * cols, false);
+  for (const vector<int>& tiles : partition) {
+    for (int tile : tiles) {
+      if (tile >= 1 && tile < rows * cols && used[tile]) {
+        cerr << "Tile " << tile << " appears in more than one pattern." << endl;
+        return 1;
+      }
+      if (tile >= 1 && tile < rows * cols)
+        used[tile] = true;
+    }
+  }
+
+  try {
+    filesystem::create_directories(directory);
+    if (!inputDirectory.empty() && filesystem::equivalent(inputDirectory, directory)) {
+      cerr << "The input and output directories must differ." << endl;
+      return 1;
+    }
+    for (const vector<int>& tiles : partition) {
+      string name = PatternDatabase::fileName(rows, cols, tiles);
+      string path = directory + "/" + name;
+      auto start = chrono::steady_clock::now();
+
+      PatternDatabase pdb;
+      if (inputDirectory.empty()) {
+        cout << "Building " << path << endl;
+        pdb = PatternDatabase::build(rows, cols, tiles, &cout, threads);
+      }
+      else {
+        cout << "Compressing " << inputDirectory + "/" + name << endl;
+        pdb = PatternDatabase::load(inputDirectory + "/" + name);
+      }
+      if (encoding != PatternDatabase::Encoding::BYTES || blockSize > 1)
+        pdb = pdb.compress(encoding, blockSize);
+      pdb.save(path);
+      chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+      cout << "Wrote " << pdb.size() << " entries in " << pdb.memoryUsage() << " bytes to "
+           << path << " in " << elapsed.count() << " seconds" << endl << endl;
+    }
+  }
+  catch (const exception& e) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+
+  return 0;
+}
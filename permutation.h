@@ -0,0 +1,119 @@
+#ifndef PERMUTATION_H
+#define PERMUTATION_H
+
+#include <bitset>
+#include <cstdint>
+
+/*********************************************************************
+ *
+ * PERMUTATION
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   lehmerRank: ranks a prefix of a permutation in linear time
+ *   lehmerUnrank: recovers a permutation prefix from its rank
+ *   lehmerCount: number of distinct ranks of a permutation prefix
+ *   boardRank: dense index of a board within its solvability class
+ *********************************************************************/
+
+/*********************************************************************
+ * lehmerRank
+ *   Ranks the first k numbers of a permutation of 0 to n-1 among all
+ *   k-number prefixes, using the Lehmer code in mixed radix n, n-1,
+ *   ..., n-k+1. Each digit is the number minus the count of smaller
+ *   numbers already used, which is a popcount of a 64-bit mask, so
+ *   ranking takes linear time.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   n must not exceed 64.
+ *********************************************************************/
+inline uint64_t lehmerRank(const int* values, int k, int n)
+{
+  uint64_t rank = 0;  // mixed-radix rank of the prefix
+  uint64_t used = 0;  // mask of numbers already seen
+
+  for (int i = 0; i < k; ++i)
+  {
+    uint64_t bit = uint64_t(1) << values[i];
+    int smaller = std::bitset<64>(used & (bit - 1)).count();
+    rank = rank * (n - i) + (values[i] - smaller);
+    used |= bit;
+  }
+
+  return rank;
+}
+
+/*********************************************************************
+ * lehmerUnrank
+ *   Recovers the first k numbers of a permutation of 0 to n-1 from
+ *   the rank given by lehmerRank. Each number is the digit-th number
+ *   not yet used, found by clearing the lowest set bits of a mask of
+ *   unused numbers.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   n must not exceed 64, and values must hold at least k numbers.
+ *********************************************************************/
+inline void lehmerUnrank(uint64_t rank, int k, int n, int* values)
+{
+  int digits[64];  // Lehmer code digits, most significant first
+  for (int i = k - 1; i >= 0; --i)
+  {
+    digits[i] = rank % (n - i);
+    rank /= n - i;
+  }
+
+  uint64_t unused = n == 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;  // mask of unused numbers
+  for (int i = 0; i < k; ++i)
+  {
+    uint64_t mask = unused;
+    for (int d = 0; d < digits[i]; ++d)
+      mask &= mask - 1;
+    uint64_t bit = mask & -mask;
+    values[i] = std::bitset<64>(bit - 1).count();
+    unused ^= bit;
+  }
+}
+
+/*********************************************************************
+ * lehmerCount
+ *   Returns the number of distinct k-number prefixes of permutations
+ *   of 0 to n-1, which is n! / (n-k)!.
+ *********************************************************************/
+inline uint64_t lehmerCount(int k, int n)
+{
+  uint64_t count = 1;
+  for (int i = 0; i < k; ++i)
+    count *= n - i;
+  return count;
+}
+
+/*********************************************************************
+ * boardRank
+ *   Returns a dense index in [0, Len!/2) for a board of Len squares.
+ *   Moves preserve the permutation parity of the tiles read in order
+ *   with the blank skipped, once the blank's square is known (the
+ *   parity changes only with the blank's row on even-width boards).
+ *   The index is therefore the blank's square followed by the rank of
+ *   the first Len-3 tiles of that sequence; the last two tiles are
+ *   implied by the others and the parity.
+ *********************************************************************/
+template <int Len, typename Board>
+uint64_t boardRank(const Board& board)
+{
+  int values[Len];  // tile numbers in board order, blank skipped, shifted to 0..Len-2
+  int blankIdx = 0; // square of the blank
+  int count = 0;    // number of tiles collected
+
+  for (int i = 0; i < Len; ++i)
+  {
+    int tile = board.tile(i);
+    if (tile == 0)
+      blankIdx = i;
+    else
+      values[count++] = tile - 1;
+  }
+
+  return blankIdx * lehmerCount(Len - 3, Len - 1) + lehmerRank(values, Len - 3, Len - 1);
+}
+
+#endif // PERMUTATION_H
@@ -0,0 +1,324 @@
+#ifndef PUZZLEBOARD_H
+#define PUZZLEBOARD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/*********************************************************************
+ *
+ * PUZZLEBOARD
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct PuzzleState: represents a particular state of an N-puzzle
+ *   struct Geometry: compile-time row, column and neighbor tables
+ *   struct PackedBoard: board of up to 16 squares packed in 64 bits
+ *   struct ByteBoard: board stored with one byte per square
+ *   struct ZobristTable: random keys for incremental board hashing
+ *   struct StateKey: board and Zobrist hash identifying a state
+ *   struct StateKeyHash: hashes a StateKey by its Zobrist hash
+ *   struct SearchNode: board and costs of a state during the search
+ *********************************************************************/
+
+/*********************************************************************
+ * PuzzleState (struct)
+ *   Manages data related to a particular puzzle state, representing
+ *   puzzle numbers as a vector of integers.
+ *********************************************************************/
+struct PuzzleState
+{
+  std::vector<int> state;  // puzzle numbers stored in the order they appear in the puzzle
+  int blankIdx;            // index of blank square within the vector
+  int g;                   // cost from initial state (operations from starting state)
+  float h;                 // heuristic cost (estimated operations to achieve goal state)
+  float f;                 // total cost (g + h)
+  int move;                // previous blank square move (1-UP, 2-DOWN, 3-LEFT, 4-RIGHT)
+
+  // CONSTRUCTORS
+  PuzzleState()
+    : state({}), blankIdx(0), g(0), h(0), f(0), move(0) {}
+  PuzzleState(std::vector<int> state)
+    : state(state), blankIdx(0), g(0), h(0), f(0), move(0) {}
+
+  // Overloaded equality operator
+  bool operator==(const PuzzleState& s)
+  {
+    // PuzzleState objects are equal if their puzzle vectors are the same
+    return state == s.state;
+  }
+};
+
+/*********************************************************************
+ * Geometry (struct)
+ *   Holds the row and column of every square of a Rows x Cols puzzle
+ *   and the square reached by each blank square move, computed at
+ *   compile time so that the search never divides by the puzzle
+ *   width. The goal row and column of number t are those of square
+ *   t - 1.
+ *
+ *   Within the search, moves are 2-bit codes 0-UP, 1-DOWN, 2-LEFT,
+ *   3-RIGHT (one less than the PuzzleState move numbers), so the move
+ *   that reverses a code is the code XOR 1.
+ *********************************************************************/
+template <int Rows, int Cols>
+struct Geometry
+{
+  static constexpr int LEN = Rows * Cols;  // number of squares
+
+  int row[LEN];          // row of each square
+  int col[LEN];          // column of each square
+  int neighbor[LEN][4];  // square reached by each move code from each square
+                         // (-1 if the move is illegal)
+
+  constexpr Geometry() : row(), col(), neighbor()
+  {
+    for (int i = 0; i < LEN; ++i)
+    {
+      row[i] = i / Cols;
+      col[i] = i % Cols;
+      neighbor[i][0] = row[i] > 0 ? i - Cols : -1;
+      neighbor[i][1] = row[i] < Rows - 1 ? i + Cols : -1;
+      neighbor[i][2] = col[i] > 0 ? i - 1 : -1;
+      neighbor[i][3] = col[i] < Cols - 1 ? i + 1 : -1;
+    }
+  }
+};
+
+// Tables of every puzzle shape, instantiated once per shape
+template <int Rows, int Cols>
+inline constexpr Geometry<Rows, Cols> GEOMETRY{};
+
+/*********************************************************************
+ * PackedBoard (struct)
+ *   Stores the numbers of a puzzle of up to 16 squares in a single
+ *   64-bit integer with 4 bits per square (square i occupies bits 4i
+ *   to 4i+3). Moving a tile is a shift/mask operation and comparing
+ *   two boards is a single integer compare.
+ *********************************************************************/
+struct PackedBoard
+{
+  uint64_t bits;  // puzzle numbers packed 4 bits per square
+
+  PackedBoard() : bits(0) {}
+
+  // Returns the number on the square at the given index
+  int tile(int idx) const
+  {
+    return (bits >> (4 * idx)) & 0xF;
+  }
+
+  // Places a number on the square at the given index
+  void set(int idx, int num)
+  {
+    bits = (bits & ~(uint64_t(0xF) << (4 * idx))) | (uint64_t(num) << (4 * idx));
+  }
+
+  // Slides the tile on square from into the blank square to. Since
+  // the blank square holds a 0, the tile is XOR-ed out of its old
+  // square and into its new one.
+  void slide(int from, int to)
+  {
+    uint64_t num = (bits >> (4 * from)) & 0xF;
+    bits ^= (num << (4 * from)) | (num << (4 * to));
+  }
+
+  bool operator==(const PackedBoard& b) const
+  {
+    return bits == b.bits;
+  }
+};
+
+/*********************************************************************
+ * ByteBoard (struct)
+ *   Stores the numbers of a puzzle with one byte per square, used for
+ *   puzzles with more than 16 squares.
+ *********************************************************************/
+template <int Len>
+struct ByteBoard
+{
+  std::array<uint8_t, Len> squares;  // puzzle numbers stored one byte per square
+
+  ByteBoard() : squares() {}
+
+  // Returns the number on the square at the given index
+  int tile(int idx) const
+  {
+    return squares[idx];
+  }
+
+  // Places a number on the square at the given index
+  void set(int idx, int num)
+  {
+    squares[idx] = num;
+  }
+
+  // Slides the tile on square from into the blank square to
+  void slide(int from, int to)
+  {
+    squares[to] = squares[from];
+    squares[from] = 0;
+  }
+
+  bool operator==(const ByteBoard& b) const
+  {
+    return squares == b.squares;
+  }
+};
+
+// Board representation used for a puzzle with the given number of squares
+template <int Len>
+using BoardFor = typename std::conditional<(Len <= 16), PackedBoard, ByteBoard<Len>>::type;
+
+/*********************************************************************
+ * ZobristTable (struct)
+ *   Holds a pseudo-random 64-bit key for every (square, number) pair
+ *   of a puzzle with Len squares, generated at compile time with
+ *   SplitMix64. The hash of a board is the XOR of the keys of its
+ *   tiles (the blank is not hashed), so sliding a tile updates the
+ *   hash in constant time: XOR out the tile's key at its old square
+ *   and XOR in its key at the new one.
+ *********************************************************************/
+template <int Len>
+struct ZobristTable
+{
+  uint64_t key[Len][Len];  // key of number n (1 to Len - 1) on square i
+
+  constexpr ZobristTable() : key()
+  {
+    uint64_t seed = 0x5eed0f15b0a4d5e7ULL;  // SplitMix64 state
+    for (int i = 0; i < Len; ++i)
+    {
+      for (int n = 1; n < Len; ++n)
+      {
+        uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        key[i][n] = z ^ (z >> 31);
+      }
+    }
+  }
+
+  // Returns the hash of a whole board (used only for starting states)
+  template <typename Board>
+  uint64_t hashOf(const Board& board) const
+  {
+    uint64_t hash = 0;
+    for (int i = 0; i < Len; ++i)
+      hash ^= key[i][board.tile(i)];
+    return hash;
+  }
+
+  // Returns the change of hash when number num slides from square from to square to
+  uint64_t slideDelta(int num, int from, int to) const
+  {
+    return key[from][num] ^ key[to][num];
+  }
+};
+
+// Zobrist keys of every puzzle size, instantiated once per size
+template <int Len>
+inline constexpr ZobristTable<Len> ZOBRIST{};
+
+/*********************************************************************
+ * StateKey (struct)
+ *   Identifies a state in a hash table by its board and its Zobrist
+ *   hash. Tables hash the key with the stored Zobrist hash, so a
+ *   lookup does no work proportional to the board size, while
+ *   equality compares the full board so that colliding hashes never
+ *   merge distinct states.
+ *********************************************************************/
+template <typename Board>
+struct StateKey
+{
+  Board board;    // board of the state
+  uint64_t hash;  // Zobrist hash of the board
+
+  StateKey() : board(), hash(0) {}
+  StateKey(const Board& board, uint64_t hash) : board(board), hash(hash) {}
+
+  // Returns true if the key does not refer to a state
+  bool empty() const
+  {
+    return board == Board();
+  }
+
+  bool operator==(const StateKey& k) const
+  {
+    return hash == k.hash && board == k.board;
+  }
+};
+
+/*********************************************************************
+ * StateKeyHash (struct)
+ *   Hashes a StateKey by returning its stored Zobrist hash.
+ *********************************************************************/
+struct StateKeyHash
+{
+  template <typename Key>
+  size_t operator()(const Key& k) const
+  {
+    return k.hash;
+  }
+};
+
+/*********************************************************************
+ * SearchNode (struct)
+ *   Manages data related to a puzzle state while it is being searched.
+ *   The board type is PackedBoard or ByteBoard depending on the size
+ *   of the puzzle. Nodes live in the NodeArena of a search and refer
+ *   to their parent by its 32-bit arena index, along with the 2-bit
+ *   code of the move that produced them from the parent.
+ *********************************************************************/
+template <typename Board>
+struct SearchNode
+{
+  Board board;             // puzzle numbers of the state
+  uint64_t hash;           // Zobrist hash of the board
+  int g;                   // cost from initial state (operations from starting state)
+  float h;                 // heuristic cost (estimated operations to achieve goal state)
+  float f;                 // total cost (g + h)
+  uint16_t walkRows;       // Walking Distance matrix of the rows and of the columns
+  uint16_t walkCols;       // (used only by the Walking Distance heuristic)
+  uint64_t conflicts;      // linear conflict count of each row, then each column,
+                           // 4 bits per line (used only by the Linear Conflict heuristic)
+  uint32_t parent;         // arena index of the parent node (unused if g == 0)
+  uint8_t blankIdx;        // index of blank square within the board
+  uint8_t move;            // code of the move that produced the state (unused if g == 0)
+  uint16_t baseCost;       // cost kept by the Manhattan Distance and Linear Conflict
+                           // heuristics to update their children's costs from
+
+  // CONSTRUCTOR
+  SearchNode()
+    : board(), hash(0), g(0), h(0), f(0), walkRows(0), walkCols(0), conflicts(0), parent(0),
+      blankIdx(0), move(0), baseCost(0) {}
+
+  // Returns the key identifying the state in a hash table
+  StateKey<Board> key() const
+  {
+    return StateKey<Board>(board, hash);
+  }
+
+  // Returns the number on the square at the given index
+  int tile(int idx) const
+  {
+    return board.tile(idx);
+  }
+
+  // Returns true if the node does not hold a board
+  bool empty() const
+  {
+    return board == Board();
+  }
+
+  // Overloaded equality operator
+  bool operator==(const SearchNode& s) const
+  {
+    // SearchNode objects are equal if their boards are the same
+    return board == s.board;
+  }
+};
+
+#endif // PUZZLEBOARD_H
@@ -0,0 +1,918 @@
+#ifndef PUZZLESOLVER_H
+#define PUZZLESOLVER_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "closedlist.h"
+#include "heuristics.h"
+#include "nodearena.h"
+#include "openlist.h"
+#include "pdb.h"
+#include "puzzleboard.h"
+#include "statetable.h"
+
+/*********************************************************************
+ *
+ * PUZZLESOLVER
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct FixedShape: board and tables of a puzzle whose dimensions
+ *                      are known at compile time
+ *   class BasicPuzzleSolver: solves a sliding puzzle of a given shape
+ *                            with a given heuristic policy
+ *   class PuzzleSolver: solves a Rows x Cols sliding puzzle whose
+ *                       dimensions are known at compile time
+ *********************************************************************/
+
+/*********************************************************************
+ * FixedShape (struct)
+ *   Describes a Rows x Cols puzzle to BasicPuzzleSolver. The board size
+ *   is a template parameter, so the row, column and neighbor lookups
+ *   come from the compile-time Geometry tables and the loops over the
+ *   board have constant bounds.
+ *
+ *   A shape provides the Board and ClosedList types, the geo tables
+ *   with row, col and neighbor lookups, the zobrist table, and the
+ *   rows(), cols() and len() dimensions.
+ *********************************************************************/
+template <int Rows, int Cols>
+struct FixedShape
+{
+  static constexpr int LEN = Rows * Cols;        // number of squares
+  using Board = BoardFor<LEN>;                   // board representation
+  using ClosedList = ClosedListFor<LEN, Board>;  // explored states table
+
+  static constexpr const Geometry<Rows, Cols>& geo = GEOMETRY<Rows, Cols>;
+  static constexpr const ZobristTable<LEN>& zobrist = ZOBRIST<LEN>;
+
+  static constexpr int rows() { return Rows; }
+  static constexpr int cols() { return Cols; }
+  static constexpr int len() { return LEN; }
+};
+
+/*********************************************************************
+ * BasicPuzzleSolver Class
+ *   Solves a sliding puzzle of the given Shape using a specified search
+ *   algorithm, presenting the solution as a sequence of states. The
+ *   search is compiled for each heuristic policy, so it calls the
+ *   policy directly. Derived classes choose the policy by name and
+ *   pass it to run().
+ *********************************************************************/
+template <typename Shape>
+class BasicPuzzleSolver
+{
+  public:
+    using Board = typename Shape::Board;  // board representation
+    using Node = SearchNode<Board>;       // search node type
+    using Key = StateKey<Board>;          // hash table key type
+
+    // PUBLIC METHODS
+    int nodesExpanded() const { return expanded; }
+    int maxQueueSize() const { return maxQueue; }
+    int goalNodeDepth() const { return goalDepth; }
+    double searchTime() const { return seconds; }
+    size_t patternMemory() const { return patternBytes; }
+    int evaluationsSaved() const { return deferred - refined; }
+
+  protected:
+    // CONSTRUCTOR
+    BasicPuzzleSolver(const PuzzleState& startState, const Shape& shape);
+
+    // PROTECTED METHODS
+    template <typename Heuristic, typename... Args>
+    std::vector<PuzzleState> run(const std::string& name, bool verbose, const Args&... args);
+
+    // ATTRIBUTES
+    Shape shape;        // board type and tables of the puzzle
+
+  private:
+    // PRIVATE METHODS
+    template <typename Queue, typename Heuristic>
+    std::vector<PuzzleState> search(const Heuristic& heuristic, bool verbose);
+    template <typename Heuristic>
+    std::vector<PuzzleState> descend(const Heuristic& heuristic, bool verbose);
+    bool isSolvable() const;
+    bool isGoal(const Node& current) const;
+    int generateChildren(const Node& current, Node children[4]) const;
+    std::vector<PuzzleState> retracePath(NodeIndex goalIdx) const;
+    PuzzleState unpackNode(const Node& current) const;
+    void displayState(const Node& current) const;
+
+    // ATTRIBUTES
+    int expanded;       // total number of nodes expanded
+    int maxQueue;       // maximum number of nodes in the frontier queue at any moment
+    int goalDepth;      // length of path to solution including initial state
+    double seconds;     // time taken by the search, in seconds
+    size_t patternBytes;  // memory of the pattern databases used by the heuristic
+    int deferred;       // nodes added to the frontier with a lazy heuristic's cheap cost
+    int refined;        // nodes whose cost a lazy heuristic refined
+    Node start;         // initial puzzle state
+    Board goal;         // goal puzzle state
+    NodeArena<Node> nodes;  // every node created by the search
+};
+
+/*********************************************************************
+ * PuzzleSolver Class
+ *   Solves a Rows x Cols sliding puzzle whose dimensions are known at
+ *   compile time with any heuristic of HEURISTIC_NAMES that supports
+ *   its size. The heuristic is selected by name once per solve.
+ *********************************************************************/
+template <int Rows, int Cols>
+class PuzzleSolver : public BasicPuzzleSolver<FixedShape<Rows, Cols>>
+{
+  public:
+    // CONSTRUCTOR
+    PuzzleSolver(const PuzzleState& startState)
+      : BasicPuzzleSolver<FixedShape<Rows, Cols>>(startState, FixedShape<Rows, Cols>()) {}
+
+    // PUBLIC METHODS
+    std::vector<PuzzleState> solve(const std::string& heuristic, bool verbose);
+    std::vector<PuzzleState> solve(int heuristic, bool verbose);
+};
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::BasicPuzzleSolver - Constructor
+ *
+ *--------------------------------------------------------------------
+ * Converts the starting state into the solver's board representation
+ * and builds the goal board. The Zobrist hash of the starting state
+ * is the only one computed from a whole board; every other hash is
+ * updated incrementally as tiles slide.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const PuzzleState& startState: the starting state of the puzzle
+ *   const Shape& shape: the shape of the puzzle
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   The starting state must hold shape.len() numbers.
+ *********************************************************************/
+template <typename Shape>
+BasicPuzzleSolver<Shape>::BasicPuzzleSolver(const PuzzleState& startState, const Shape& shape)
+  : shape(shape), expanded(0), maxQueue(0), goalDepth(0), seconds(0), patternBytes(0),
+    deferred(0), refined(0)
+{
+  for (int i = 0; i < shape.len(); ++i)
+  {
+    start.board.set(i, startState.state[i]);
+    if (startState.state[i] == 0)
+      start.blankIdx = i;
+  }
+
+  start.hash = shape.zobrist.hashOf(start.board);
+
+  // The goal board holds number i + 1 on square i and the blank on the last square
+  for (int i = 0; i < shape.len() - 1; ++i)
+    goal.set(i, i + 1);
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::run - Protected Method
+ *
+ *--------------------------------------------------------------------
+ * Constructs the heuristic policy and solves the puzzle with it. The
+ * policy's costs decide how the puzzle is solved: exact distances are
+ * followed to the goal without searching, whole-number costs are
+ * searched with a bucket queue indexed by total cost, and fractional
+ * costs fall back to a binary heap.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const std::string& name: name of the heuristic, for error messages
+ *   bool verbose: true to output each step of the search
+ *   const Args&... args: arguments of the policy's constructor
+ * RETURNS
+ *   The solution to the puzzle, or an empty vector if the puzzle is
+ *   not solvable.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   Throws invalid_argument if the heuristic does not support the
+ *   puzzle size.
+ *********************************************************************/
+template <typename Shape>
+template <typename Heuristic, typename... Args>
+std::vector<PuzzleState> BasicPuzzleSolver<Shape>::run(const std::string& name, bool verbose,
+                                                       const Args&... args)
+{
+  if constexpr (!Heuristic::SUPPORTED)
+  {
+    throw std::invalid_argument("PuzzleSolver: the \"" + name + "\" heuristic does not support "
+                                + std::to_string(shape.rows()) + "x"
+                                + std::to_string(shape.cols()) + " puzzles");
+  }
+  else
+  {
+    if (!isSolvable())
+    {
+      if (verbose)
+        std::cout << "PUZZLE IS NOT SOLVABLE" << std::endl;
+      return std::vector<PuzzleState>();
+    }
+
+    // Pattern databases are loaded with the policy, before the search starts
+    Heuristic heuristic(args...);
+    patternBytes = heuristic.memoryUsage();
+
+    if (verbose)
+      std::cout << "SOLVING PUZZLE..." << std::endl << std::endl;
+
+    if constexpr (Heuristic::EXACT)  // every distance is known, so there is nothing to search
+      return descend(heuristic, verbose);
+    else if constexpr (Heuristic::INTEGRAL)
+      return search<BucketQueue>(heuristic, verbose);
+    else
+      return search<HeapQueue>(heuristic, verbose);
+  }
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::search - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Runs the A* graph search with the given open list type and
+ * heuristic policy.
+ *
+ * Maximizes efficiency by allocating every node once in a chunked
+ * arena and referring to it everywhere else by its 32-bit index: the
+ * open list orders node indices by total cost, preferring deeper
+ * states among equal costs, an open-addressing table keyed by the
+ * board and its Zobrist hash maps frontier states to their nodes,
+ * and a closed list maps explored states to their nodes. Both tables
+ * allow checking if a state already exists in constant time without
+ * inserting anything; on puzzles of up to 9 squares the closed list
+ * is a flat array indexed by permutation rank. The tables belong to
+ * the search alone, so a descent along an exact table never builds
+ * them. The arena is released in bulk once the solution has been
+ * extracted.
+ *
+ * Every state has at most one node in the frontier. When a shorter
+ * path to a frontier state is found, its node takes the new cost and
+ * parent and is moved within the open list (decrease-key), so the
+ * search never expands a state through a longer path than it knows.
+ * With a consistent heuristic an explored state has already been
+ * reached by a shortest path. Pattern database costs are admissible
+ * but not consistent, since each is the minimum over every position
+ * of the blank, and the reflected and dual lookups even less so, so
+ * an explored state reached by a shorter path is reopened: its node
+ * takes the new cost and parent and returns to the frontier. The
+ * children of states not seen before are then evaluated together by
+ * the heuristic, which can share its work on the expanded state
+ * across them, and added to the frontier.
+ *
+ * With a lazy heuristic, nodes enter the frontier with its cheap
+ * cost, and the full cost of a node is computed when it reaches the
+ * front of the open list. If the full cost is higher, the node goes
+ * back into the open list with it and the next node is taken; only
+ * nodes whose full cost is still the least are expanded. The nodes
+ * never refined are counted as evaluations saved.
+ *
+ * A starting state that is already the goal is returned without
+ * searching, since the board of a 1x1 puzzle is all zeros, which the
+ * state tables reserve for their empty slots.
+ *
+ * When verbose output is requested, outputs relevant information at
+ * each step of the solving process and, upon puzzle completion,
+ * displays a concluding statement that provides insight into the
+ * time and space management of the search algorithm used.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Heuristic& heuristic: the heuristic policy to use
+ *   bool verbose: true to output each step of the search
+ * RETURNS
+ *   The solution to the puzzle, or an empty vector if the frontier
+ *   is exhausted.
+ *********************************************************************/
+template <typename Shape>
+template <typename Queue, typename Heuristic>
+std::vector<PuzzleState> BasicPuzzleSolver<Shape>::search(const Heuristic& heuristic, bool verbose)
+{
+  Queue frontierQueue;             // indices of frontier nodes ordered by total cost
+  StateTable<Board, NodeIndex> frontierStates;  // nodes of current frontier states
+  typename Shape::ClosedList exploredStates;    // nodes of current explored states
+  Node children[4];                // children states generated from the current state
+  float costs[4];                  // heuristic costs of the new children states
+  std::vector<PuzzleState> result; // sequence of states constituting path to solution
+  bool startExpanded = false;      // indicates whether the starting state has been expanded
+  auto startTime = std::chrono::steady_clock::now();  // time the search started
+
+  // Initialize the cost values of the starting state using the specified heuristic
+  start.g = 0;
+  start.h = heuristic.initialize(start);
+  start.f = start.g + start.h;
+
+  if (isGoal(start))
+  {
+    result.push_back(unpackNode(start));
+    goalDepth = result.size();
+    if (verbose)
+    {
+      displayState(start);
+      std::cout << std::endl << "GOAL" << std::endl << std::endl;
+    }
+    return result;
+  }
+
+  if constexpr (Heuristic::LAZY)
+    deferred++;
+
+  // Place the starting state into the frontier queue
+  NodeIndex startIdx = nodes.allocate(start);
+  frontierQueue.push(startIdx, start.f, start.g);
+  frontierStates.insert(start.key(), startIdx);
+
+  // Continue expanding states until the queue becomes empty or a goal state is reached
+  while (!frontierQueue.empty())
+  {
+    // Remove the frontier state with the least total cost from the frontier queue and
+    // set it as the current state
+    NodeIndex currentIdx = frontierQueue.pop();
+    const Node& current = nodes[currentIdx];
+
+    // With a lazy heuristic, refine the cost of the state, and put it back into the
+    // frontier queue if it is no longer among the least costly
+    if constexpr (Heuristic::LAZY)
+    {
+      if (!heuristic.isRefined(current) && !isGoal(current))
+      {
+        Node& node = nodes[currentIdx];
+        float h = heuristic.refine(node);
+        refined++;
+        if (h > node.h)
+        {
+          node.h = h;
+          node.f = node.g + node.h;
+          frontierQueue.push(currentIdx, node.f, node.g);
+          continue;
+        }
+      }
+    }
+
+    frontierStates.erase(current.key());
+
+    // If the goal state is reached, obtain the solution path and output the time and
+    // space resources used by the search algorithm
+    if (isGoal(current))
+    {
+      result = retracePath(currentIdx);
+      goalDepth = result.size();
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+      seconds = elapsed.count();
+      if (verbose)
+      {
+        displayState(current);
+        std::cout << std::endl << "GOAL" << std::endl << std::endl;
+        std::cout << "To solve this problem, the search algorithm expanded a total of ";
+        std::cout << expanded << " nodes." << std::endl;
+        std::cout << "The maximum number of nodes in the queue at any one time was ";
+        std::cout << maxQueue << "." << std::endl;
+        std::cout << "The depth of the goal node was " << goalDepth << "." << std::endl;
+        if (patternBytes > 0)
+        {
+          std::cout << "The pattern databases occupy " << patternBytes;
+          std::cout << " bytes." << std::endl;
+        }
+        if constexpr (Heuristic::LAZY)
+        {
+          std::cout << "The full heuristic was evaluated for " << refined << " of the ";
+          std::cout << deferred << " nodes generated, saving " << evaluationsSaved();
+          std::cout << " evaluations." << std::endl;
+        }
+      }
+      break;
+    }
+
+    // Check if the current state already exists as an explored state and whether it
+    // should be expanded
+    if (exploredStates.find(current.key()) == NO_NODE)
+    {
+      if (verbose && startExpanded)
+      {
+        // Display the current state being expanded and its cost values
+        std::cout << "The best state to expand with g(n) = " << current.g;
+        std::cout << " and h(n) = " << current.h << " is..." << std::endl;
+        displayState(current);
+        std::cout << "Expanding this node..." << std::endl << std::endl;
+      }
+      else if (verbose)
+      {
+        // Cost values are not displayed when expanding the starting state
+        std::cout << "Expanding state" << std::endl;
+        displayState(current);
+        std::cout << std::endl;
+        startExpanded = true;
+      }
+
+      // Increment the nodes-expanded counter, add the current state to the list of
+      // explored states, and generate a list of children states
+      expanded++;
+      exploredStates.insert(current.key(), currentIdx);
+      int childCount = generateChildren(current, children);
+      int newCount = 0;  // number of children of states not seen before
+
+      // Initialize the attributes of each child state to correct values
+      for (int i = 0; i < childCount; ++i)
+      {
+        Node& child = children[i];
+
+        // The cost g(n) of the child state is the g(n) of the current state plus 1
+        child.g = current.g + 1;
+
+        // If the child state is already a frontier state, keep the shorter of the two
+        // paths to it by moving its node up the frontier queue
+        if (const NodeIndex* queuedIdx = frontierStates.find(child.key()))
+        {
+          Node& queued = nodes[*queuedIdx];
+          if (child.g < queued.g)
+          {
+            queued.g = child.g;
+            queued.f = queued.g + queued.h;
+            queued.parent = currentIdx;
+            queued.move = child.move;
+            frontierQueue.update(*queuedIdx, queued.f, queued.g);
+          }
+          continue;
+        }
+
+        // Skip the child state if it has already been explored, unless this path to it
+        // is shorter, which only an inconsistent heuristic allows: then reopen it
+        NodeIndex closedIdx = exploredStates.find(child.key());
+        if (closedIdx != NO_NODE)
+        {
+          Node& closed = nodes[closedIdx];
+          if (child.g < closed.g)
+          {
+            closed.g = child.g;
+            closed.f = closed.g + closed.h;
+            closed.parent = currentIdx;
+            closed.move = child.move;
+            exploredStates.erase(child.key());
+            frontierQueue.push(closedIdx, closed.f, closed.g);
+            frontierStates.insert(child.key(), closedIdx);
+          }
+          continue;
+        }
+
+        // Keep the child state, at the front of the array, for evaluation
+        children[newCount++] = child;
+      }
+
+      // The heuristic costs h(n) of the new children are derived from the current
+      // state's together, so the heuristic can share its work across them
+      evaluateChildren(heuristic, current, children, costs, newCount);
+
+      if constexpr (Heuristic::LAZY)
+        deferred += newCount;
+
+      for (int i = 0; i < newCount; ++i)
+      {
+        Node& child = children[i];
+        child.h = costs[i];
+        child.f = child.g + child.h;
+        child.parent = currentIdx;
+
+        // Add the child state to the arena and the frontier
+        NodeIndex childIdx = nodes.allocate(child);
+        frontierQueue.push(childIdx, child.f, child.g);
+        frontierStates.insert(child.key(), childIdx);
+      }
+
+      // Update the maximum recorded number of nodes in the queue if necessary
+      if ((int)frontierQueue.size() > maxQueue)
+        maxQueue = frontierQueue.size();
+    }
+  }
+
+  nodes.clear();
+  return result;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::descend - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Solves the puzzle without searching by reading the exact distance
+ * to the goal of every state from an exact heuristic: from the
+ * starting state, repeatedly moves to a child one move closer to the
+ * goal, which every state but the goal has. Each state of the path
+ * counts as expanded, and the frontier is never used, so the time
+ * taken grows with the solution depth only.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Heuristic& heuristic: the exact heuristic policy to follow
+ *   bool verbose: true to output each step of the descent
+ * RETURNS
+ *   The solution to the puzzle in the form of a vector of states.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   The puzzle must be solvable.
+ * POST-CONDITIONS
+ *   Stores the data collected during the descent in the appropriate
+ *   class attributes.
+ *********************************************************************/
+template <typename Shape>
+template <typename Heuristic>
+std::vector<PuzzleState> BasicPuzzleSolver<Shape>::descend(const Heuristic& heuristic,
+                                                           bool verbose)
+{
+  std::vector<PuzzleState> result;  // sequence of states constituting path to solution
+  Node children[4];                 // children states generated from the current state
+  float costs[4];                   // distances of the children states to the goal
+  Node current = start;            // state reached by the descent
+  auto startTime = std::chrono::steady_clock::now();  // time the descent started
+
+  current.g = 0;
+  current.h = heuristic.initialize(current);
+  current.f = current.h;
+  result.push_back(unpackNode(current));
+
+  while (!isGoal(current))
+  {
+    if (verbose)
+    {
+      std::cout << "The state with g(n) = " << current.g << " is " << current.h;
+      std::cout << " moves from the goal:" << std::endl;
+      displayState(current);
+      std::cout << std::endl;
+    }
+
+    // Move to the first child that is one move closer to the goal
+    expanded++;
+    int childCount = generateChildren(current, children);
+    evaluateChildren(heuristic, current, children, costs, childCount);
+    for (int i = 0; i < childCount; ++i)
+    {
+      int distance = costs[i];
+      if (distance == current.h - 1)
+      {
+        children[i].g = current.g + 1;
+        children[i].h = distance;
+        children[i].f = children[i].g + children[i].h;
+        current = children[i];
+        break;
+      }
+    }
+    result.push_back(unpackNode(current));
+  }
+
+  goalDepth = result.size();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+  seconds = elapsed.count();
+  if (verbose)
+  {
+    displayState(current);
+    std::cout << std::endl << "GOAL" << std::endl << std::endl;
+    std::cout << "The distance table led to the goal through " << expanded;
+    std::cout << " states without searching." << std::endl;
+    std::cout << "The depth of the goal node was " << goalDepth << "." << std::endl;
+  }
+
+  return result;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::isSolvable - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Determines whether the puzzle is solvable by counting the number
+ * of inversions in the starting state. An inversion is formed when a
+ * tile comes before another tile with a lower value.
+ *--------------------------------------------------------------------
+ * RETURNS
+ *   A boolean value that is true if the puzzle is solvable, or false
+ *   if it is unsolvable.
+ *********************************************************************/
+template <typename Shape>
+bool BasicPuzzleSolver<Shape>::isSolvable() const
+{
+  int inversionCount = 0;  // total number of inversions
+
+  // Count the number of inversions in the puzzle's starting state
+  for (int i = 0; i < shape.len(); ++i)
+  {
+    // Skip blank tile
+    if (start.tile(i) == 0)
+      continue;
+
+    for (int j = i + 1; j < shape.len(); ++j)
+    {
+      // Skip blank tile
+      if (start.tile(j) == 0)
+        continue;
+
+      if (start.tile(j) < start.tile(i))
+        inversionCount++;
+    }
+  }
+
+  // If the puzzle width is odd, then the puzzle is solvable only if the number of
+  // inversions is even
+  if (shape.cols() % 2 == 1)
+    return inversionCount % 2 == 0;
+
+  // If the puzzle width is even, then the puzzle is solvable only if either the
+  // number of inversions is odd and the blank tile is on an even row from the bottom,
+  // or the number of inversions is even and the blank tile is on an odd row from bottom
+  return (inversionCount + (shape.rows() - shape.geo.row[start.blankIdx])) % 2 == 1;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::isGoal - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Determines whether the given state is the goal state by comparing
+ * its board against the goal board.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Node& current: the state to check if it is the goal
+ * RETURNS
+ *   A boolean value that is true if the given state is the goal
+ *   state, or false if otherwise.
+ *********************************************************************/
+template <typename Shape>
+bool BasicPuzzleSolver<Shape>::isGoal(const Node& current) const
+{
+  return current.board == goal;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::generateChildren - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Generates a list of children states that can result from the given
+ * state depending on the possible blank square operations that can
+ * be performed, using the neighbor table of the puzzle geometry. The
+ * Zobrist hash of each child is derived from its parent's hash by
+ * moving the key of the slid tile.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Node& current: the state from which to generate children
+ *   Node children[4]: receives the possible children states
+ * RETURNS
+ *   The number of children states written to the array.
+ * --------------------------------------------------------------------
+ * POST-CONDITION
+ *   Only initializes child state attributes that relate to the
+ *   child's board, hash, blank square index, and blank square move.
+ *********************************************************************/
+template <typename Shape>
+int BasicPuzzleSolver<Shape>::generateChildren(const Node& current, Node children[4]) const
+{
+  int count = 0;  // number of children states generated
+
+  // Moves are tried in the order UP, DOWN, LEFT, RIGHT
+  for (int move = 0; move < 4; ++move)
+  {
+    int tileIdx = shape.geo.neighbor[current.blankIdx][move];
+    if (tileIdx < 0)
+      continue;
+
+    // Slide the neighboring tile into the blank square
+    Node child = current;
+    child.hash ^= shape.zobrist.slideDelta(current.tile(tileIdx), tileIdx, current.blankIdx);
+    child.board.slide(tileIdx, current.blankIdx);
+    child.blankIdx = tileIdx;
+    child.move = move;
+
+    children[count++] = child;
+  }
+
+  return count;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::retracePath - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Generates the sequence of intermediate states leading up to the
+ * given node from the starting state by following the parent index
+ * of each node through the arena.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   NodeIndex goalIdx: arena index of the node to generate the path to
+ * RETURNS
+ *   A vector of intermediate states that lead to the given node from
+ *   the starting state.
+ *********************************************************************/
+template <typename Shape>
+std::vector<PuzzleState> BasicPuzzleSolver<Shape>::retracePath(NodeIndex goalIdx) const
+{
+  std::deque<PuzzleState> path;  // sequence of states leading to the goal node
+  const Node* node = &nodes[goalIdx];  // the current intermediate state
+
+  // Continue adding states to the path until a state with g(n) = 0 is encountered,
+  // which indicates that the starting state has been reached
+  path.push_front(unpackNode(*node));
+  while (node->g != 0)
+  {
+    // Add the parent state to the front of the sequence
+    node = &nodes[node->parent];
+    path.push_front(unpackNode(*node));
+  }
+
+  return std::vector<PuzzleState>(path.begin(), path.end());
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::unpackNode - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Converts a search node back into a PuzzleState holding the puzzle
+ * numbers as a vector of integers.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Node& current: the state to unpack
+ * RETURNS
+ *   The PuzzleState equivalent to the given search node.
+ *********************************************************************/
+template <typename Shape>
+PuzzleState BasicPuzzleSolver<Shape>::unpackNode(const Node& current) const
+{
+  PuzzleState state(std::vector<int>(shape.len(), 0));  // unpacked state
+
+  for (int i = 0; i < shape.len(); ++i)
+    state.state[i] = current.tile(i);
+  state.blankIdx = current.blankIdx;
+  state.g = current.g;
+  state.h = current.h;
+  state.f = current.f;
+  state.move = current.g == 0 ? 0 : current.move + 1;
+
+  return state;
+}
+
+/*********************************************************************
+ *
+ * BasicPuzzleSolver::displayState - Private Method
+ *
+ *--------------------------------------------------------------------
+ * Displays a given state of the puzzle by formatting the output of
+ * numbers to ensure proper alignment, regardless of puzzle size.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const Node& current: the state to display
+ *********************************************************************/
+template <typename Shape>
+void BasicPuzzleSolver<Shape>::displayState(const Node& current) const
+{
+  int width = std::to_string(shape.len() - 1).length();  // number of characters in largest number
+
+  // Display the properly formatted puzzle state
+  for (int i = 0; i < shape.len(); ++i)
+  {
+    std::cout << current.tile(i);
+    std::cout << std::string(width - std::to_string(current.tile(i)).length() + 1, ' ');
+
+    if (shape.geo.col[i] == shape.cols() - 1)
+      std::cout << std::endl;
+  }
+}
+
+/*********************************************************************
+ *
+ * PuzzleSolver::solve - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Runs a graph-search algorithm using the heuristic of the given name
+ * to find an optimal solution to the puzzle. This is the only place
+ * where the heuristic is chosen: each name selects a heuristic policy
+ * type, and the search compiled for that type runs to the end.
+ *--------------------------------------------------------------------
+ * PARAMETERS
+ *   const std::string& heuristic: name of the heuristic to use
+ *       "ucs"               - Uniform Cost Search
+ *       "misplaced"         - A* with Misplaced Tile heuristic
+ *       "euclidean"         - A* with Euclidean Distance heuristic
+ *       "manhattan"         - A* with Manhattan Distance heuristic
+ *       "linear-conflict"   - A* with Manhattan Distance + Linear Conflict
+ *       "pdb-663"           - A* with additive 6-6-3 pattern databases
+ *       "pdb-78"            - A* with additive 7-8 pattern databases
+ *       "pdb-663-symmetric" - A* with 6-6-3 databases, max of direct,
+ *                             reflected and dual lookups
+ *       "pdb-78-symmetric"  - A* with 7-8 databases, max of direct,
+ *                             reflected and dual lookups
+ *       "walking-distance"  - A* with Walking Distance heuristic
+ *       "exact"             - Descent along an exact distance table
+ *       "max(walking-distance,linear-conflict)"
+ *                           - A* with max of Walking Distance and
+ *                             Manhattan Distance + Linear Conflict
+ *       "lazy(pdb-663)", "lazy(pdb-78)", "lazy(pdb-663-symmetric)",
+ *       "lazy(pdb-78-symmetric)"
+ *                           - Lazy A* with the pattern databases of the
+ *                             name in parentheses, which are only looked
+ *                             up for nodes at the front of the open
+ *                             list, and the Manhattan Distance for the
+ *                             others
+ *   bool verbose: true to output each step of the search
+ * RETURNS
+ *   The solution to the puzzle in the form of a vector of states
+ *   that represent the optimal sequence of blank square operations
+ *   leading to the goal state.
+ *--------------------------------------------------------------------
+ * PRE-CONDITIONS
+ *   Throws invalid_argument if the name is unknown or the heuristic
+ *   does not support the puzzle: the pattern database heuristics use
+ *   the 15-puzzle partitions and require a 4x4 puzzle, the Walking
+ *   Distance heuristics a square puzzle of up to 4x4, and the exact
+ *   distance table a puzzle of up to 9 squares.
+ * POST-CONDITIONS
+ *   Stores the data collected during the graph-search process in the
+ *   appropriate class attributes.
+ *********************************************************************/
+template <int Rows, int Cols>
+std::vector<PuzzleState> PuzzleSolver<Rows, Cols>::solve(const std::string& heuristic,
+                                                         bool verbose)
+{
+  using WalkingDistance = WalkingDistanceHeuristic<Rows, Cols>;
+  using LinearConflict = LinearConflictHeuristic<Rows, Cols>;
+  using Manhattan = ManhattanHeuristic<Rows, Cols>;
+  using PatternDatabase = PatternDatabaseHeuristic<Rows, Cols, false>;
+  using SymmetricPatternDatabase = PatternDatabaseHeuristic<Rows, Cols, true>;
+
+  if (heuristic == "ucs")
+    return this->template run<UniformCostHeuristic<Rows, Cols>>(heuristic, verbose);
+  else if (heuristic == "misplaced")
+    return this->template run<MisplacedTileHeuristic<Rows, Cols>>(heuristic, verbose);
+  else if (heuristic == "euclidean")
+    return this->template run<EuclideanHeuristic<Rows, Cols>>(heuristic, verbose);
+  else if (heuristic == "manhattan")
+    return this->template run<ManhattanHeuristic<Rows, Cols>>(heuristic, verbose);
+  else if (heuristic == "linear-conflict")
+    return this->template run<LinearConflict>(heuristic, verbose);
+  else if (heuristic == "pdb-663")
+    return this->template run<PatternDatabase>(heuristic, verbose, PARTITION_663);
+  else if (heuristic == "pdb-78")
+    return this->template run<PatternDatabase>(heuristic, verbose, PARTITION_78);
+  else if (heuristic == "pdb-663-symmetric")
+    return this->template run<SymmetricPatternDatabase>(heuristic, verbose, PARTITION_663);
+  else if (heuristic == "pdb-78-symmetric")
+    return this->template run<SymmetricPatternDatabase>(heuristic, verbose, PARTITION_78);
+  else if (heuristic == "walking-distance")
+    return this->template run<WalkingDistance>(heuristic, verbose);
+  else if (heuristic == "exact")
+    return this->template run<ExactDistanceHeuristic<Rows, Cols>>(heuristic, verbose);
+  else if (heuristic == "max(walking-distance,linear-conflict)")
+    return this->template run<MaxHeuristic<WalkingDistance, LinearConflict>>(heuristic, verbose);
+  else if (heuristic == "lazy(pdb-663)")
+    return this->template run<LazyHeuristic<Manhattan, PatternDatabase>>(heuristic, verbose,
+                                                                          PARTITION_663);
+  else if (heuristic == "lazy(pdb-78)")
+    return this->template run<LazyHeuristic<Manhattan, PatternDatabase>>(heuristic, verbose,
+                                                                          PARTITION_78);
+  else if (heuristic == "lazy(pdb-663-symmetric)")
+    return this->template run<LazyHeuristic<Manhattan, SymmetricPatternDatabase>>(
+        heuristic, verbose, PARTITION_663);
+  else if (heuristic == "lazy(pdb-78-symmetric)")
+    return this->template run<LazyHeuristic<Manhattan, SymmetricPatternDatabase>>(
+        heuristic, verbose, PARTITION_78);
+
+  throw std::invalid_argument("PuzzleSolver: unknown heuristic \"" + heuristic + "\"");
+}
+
+/*********************************************************************
+ *
+ * PuzzleSolver::solve - Public Method
+ *
+ *--------------------------------------------------------------------
+ * Same as the solve() function above, with the heuristic given by its
+ * number in HEURISTIC_NAMES:
+ *                  1 - Uniform Cost Search
+ *                  2 - A* with Misplaced Tile heuristic
+ *                  3 - A* with Euclidean Distance heuristic
+ *                  4 - A* with Manhattan Distance heuristic
+ *                  5 - A* with Manhattan Distance + Linear Conflict
+ *                  6 - A* with additive 6-6-3 pattern databases
+ *                  7 - A* with additive 7-8 pattern databases
+ *                  8 - A* with 6-6-3 databases, max of direct, reflected
+ *                      and dual lookups
+ *                  9 - A* with 7-8 databases, max of direct, reflected
+ *                      and dual lookups
+ *                 10 - A* with Walking Distance heuristic
+ *                 11 - Descent along an exact distance table
+ *                 12 - A* with max of Walking Distance and Manhattan
+ *                      Distance + Linear Conflict
+ *                 13 - Lazy A* with 6-6-3 pattern databases
+ *                 14 - Lazy A* with 7-8 pattern databases
+ *                 15 - Lazy A* with 6-6-3 databases and symmetric lookups
+ *                 16 - Lazy A* with 7-8 databases and symmetric lookups
+ * Other numbers throw invalid_argument.
+ *********************************************************************/
+template <int Rows, int Cols>
+std::vector<PuzzleState> PuzzleSolver<Rows, Cols>::solve(int heuristic, bool verbose)
+{
+  return solve(heuristicName(heuristic), verbose);
+}
+
+#endif // PUZZLESOLVER_H
@@ -0,0 +1,151 @@
+#ifndef STATETABLE_H
+#define STATETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "puzzleboard.h"
+
+/*********************************************************************
+ *
+ * STATETABLE
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class StateTable: open-addressing hash table from states to values
+ *********************************************************************/
+
+/*********************************************************************
+ * StateTable Class
+ *   Maps puzzle states to small values using open addressing with
+ *   linear probing. Each slot holds only the board, the low 32 bits
+ *   of the state's Zobrist hash and the value, so no per-entry heap
+ *   allocation is made. Lookups never insert, an all-zero board marks
+ *   an empty slot, and erased entries are removed by shifting later
+ *   entries of the probe sequence back, so no tombstones accumulate.
+ *   The table doubles in capacity whenever the number of entries would
+ *   exceed the configured maximum load factor.
+ *********************************************************************/
+template <typename Board, typename Value>
+class StateTable
+{
+  public:
+    using Key = StateKey<Board>;
+
+    // CONSTRUCTOR
+    explicit StateTable(float maxLoadFactor = 0.5f, size_t initialCapacity = 1024)
+      : count(0), maxLoad(maxLoadFactor)
+    {
+      size_t capacity = 16;
+      while (capacity < initialCapacity)
+        capacity *= 2;
+      slots.resize(capacity);
+      mask = capacity - 1;
+    }
+
+    // Returns the value stored for the given state, or nullptr if it is absent
+    Value* find(const Key& key)
+    {
+      for (size_t i = key.hash & mask; !slots[i].empty(); i = (i + 1) & mask)
+      {
+        if (slots[i].hash == uint32_t(key.hash) && slots[i].board == key.board)
+          return &slots[i].value;
+      }
+      return nullptr;
+    }
+
+    const Value* find(const Key& key) const
+    {
+      return const_cast<StateTable*>(this)->find(key);
+    }
+
+    // Stores a value for the given state, replacing any value already stored
+    void insert(const Key& key, const Value& value)
+    {
+      if (Value* existing = find(key))
+      {
+        *existing = value;
+        return;
+      }
+
+      if (count + 1 > maxLoad * slots.size())
+        grow();
+      place(Slot(key.board, uint32_t(key.hash), value));
+      count++;
+    }
+
+    // Removes the given state; returns false if it was absent
+    bool erase(const Key& key)
+    {
+      size_t i = key.hash & mask;  // slot being emptied
+      while (!(slots[i].hash == uint32_t(key.hash) && slots[i].board == key.board))
+      {
+        if (slots[i].empty())
+          return false;
+        i = (i + 1) & mask;
+      }
+
+      // Shift back every later entry of the probe sequence whose home slot does not
+      // lie between the emptied slot and its current slot
+      for (size_t j = (i + 1) & mask; !slots[j].empty(); j = (j + 1) & mask)
+      {
+        size_t home = slots[j].hash & mask;
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+          slots[i] = slots[j];
+          i = j;
+        }
+      }
+      slots[i] = Slot();
+      count--;
+      return true;
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return slots.size(); }
+    size_t memoryUsage() const { return slots.size() * sizeof(Slot); }
+
+  private:
+    struct Slot
+    {
+      Board board;    // board of the state (all zero if the slot is empty)
+      uint32_t hash;  // low 32 bits of the state's Zobrist hash
+      Value value;    // value stored for the state
+
+      Slot() : board(), hash(0), value() {}
+      Slot(const Board& board, uint32_t hash, const Value& value)
+        : board(board), hash(hash), value(value) {}
+
+      bool empty() const { return board == Board(); }
+    };
+
+    // Places an entry known to be absent into the first free slot of its probe sequence
+    void place(const Slot& slot)
+    {
+      size_t i = slot.hash & mask;
+      while (!slots[i].empty())
+        i = (i + 1) & mask;
+      slots[i] = slot;
+    }
+
+    // Doubles the capacity of the table and reinserts every entry
+    void grow()
+    {
+      std::vector<Slot> old(slots.size() * 2);
+      old.swap(slots);
+      mask = slots.size() - 1;
+      for (const Slot& slot : old)
+      {
+        if (!slot.empty())
+          place(slot);
+      }
+    }
+
+    // ATTRIBUTES
+    std::vector<Slot> slots;  // open-addressing slots, capacity is a power of two
+    size_t mask;              // capacity minus one
+    size_t count;             // number of entries stored
+    float maxLoad;            // maximum ratio of entries to slots before growing
+};
+
+#endif // STATETABLE_H
@@ -0,0 +1,70 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*********************************************************************
+ *
+ * CHECK
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   struct TestCase: a named test function
+ *   TEST: defines a test and registers it with the test program
+ *   CHECK: records a failure if a condition does not hold
+ *
+ * Every source file of the tests directory defines its tests with
+ * TEST, and the test program built from them runs each one and
+ * reports the CHECKs that failed.
+ *********************************************************************/
+
+struct TestCase
+{
+  std::string name;  // name of the test
+  void (*run)();     // function running the test
+};
+
+// Returns every registered test
+inline std::vector<TestCase>& testCases()
+{
+  static std::vector<TestCase> cases;
+  return cases;
+}
+
+// Returns the number of CHECKs that have failed
+inline int& failedChecks()
+{
+  static int failed = 0;
+  return failed;
+}
+
+// Registers a test when it is constructed, before main runs
+struct TestRegistration
+{
+  TestRegistration(const std::string& name, void (*run)())
+  {
+    testCases().push_back(TestCase{name, run});
+  }
+};
+
+#define TEST(name)                                          \
+  void name();                                              \
+  static TestRegistration name##Registration(#name, name);  \
+  void name()
+
+// The condition is taken as variadic arguments, since the commas of template
+// argument lists would otherwise split it
+#define CHECK(...)                                                  \
+  do                                                                \
+  {                                                                 \
+    if (!(__VA_ARGS__))                                             \
+    {                                                               \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK("        \
+                << #__VA_ARGS__ << ") failed" << std::endl;         \
+      failedChecks()++;                                             \
+    }                                                               \
+  } while (false)
+
+#endif // CHECK_H
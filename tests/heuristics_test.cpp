@@ -0,0 +1,173 @@
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "check.h"
+#include "dynamicsolver.h"
+#include "heuristics.h"
+#include "npuzzle.h"
+#include "pdb.h"
+using namespace std;
+
+// Returns the board reached from the goal of a dim x dim puzzle by a random walk of
+// the blank, which never undoes its previous move
+static vector<int> scrambledBoard(int dim, int moves, mt19937& rng)
+{
+  vector<int> board(dim * dim, 0);
+  for (int i = 0; i < dim * dim - 1; ++i)
+    board[i] = i + 1;
+
+  int blank = dim * dim - 1;  // square of the blank
+  int previous = -1;          // square the blank came from
+  for (int k = 0; k < moves; ++k)
+  {
+    vector<int> neighbors;
+    if (blank >= dim)
+      neighbors.push_back(blank - dim);
+    if (blank < dim * (dim - 1))
+      neighbors.push_back(blank + dim);
+    if (blank % dim > 0)
+      neighbors.push_back(blank - 1);
+    if (blank % dim < dim - 1)
+      neighbors.push_back(blank + 1);
+
+    int next;
+    do
+      next = neighbors[rng() % neighbors.size()];
+    while (next == previous);
+    swap(board[blank], board[next]);
+    previous = blank;
+    blank = next;
+  }
+
+  return board;
+}
+
+// Returns true if a solution starts at the given board, ends at the goal, and moves
+// one tile into the adjacent blank square at each step
+static bool isValidSolution(const vector<int>& start, const vector<PuzzleState>& path,
+                            int dim)
+{
+  if (path.empty() || path.front().state != start)
+    return false;
+
+  for (size_t k = 1; k < path.size(); ++k)
+  {
+    const vector<int>& before = path[k - 1].state;
+    const vector<int>& after = path[k].state;
+    int changed = 0;
+    int blankBefore = -1;
+    int blankAfter = -1;
+    for (int i = 0; i < dim * dim; ++i)
+    {
+      changed += before[i] != after[i];
+      if (before[i] == 0)
+        blankBefore = i;
+      if (after[i] == 0)
+        blankAfter = i;
+    }
+    int rowDist = abs(blankBefore / dim - blankAfter / dim);
+    int colDist = abs(blankBefore % dim - blankAfter % dim);
+    if (changed != 2 || rowDist + colDist != 1)
+      return false;
+  }
+
+  for (int i = 0; i < dim * dim - 1; ++i)
+  {
+    if (path.back().state[i] != i + 1)
+      return false;
+  }
+  return true;
+}
+
+// Solves the board with every numbered heuristic that supports its size and checks
+// that each finds a valid solution as short as the exact distance table's
+static void checkAgainstExact(const vector<int>& board, int dim)
+{
+  NPuzzle reference(board);
+  vector<PuzzleState> exact = reference.solve("exact");
+  CHECK(isValidSolution(board, exact, dim));
+
+  for (const string& name : HEURISTIC_NAMES)
+  {
+    NPuzzle puzzle(board);
+    try
+    {
+      vector<PuzzleState> path = puzzle.solve(name);
+      CHECK(isValidSolution(board, path, dim));
+      CHECK(path.size() == exact.size());
+    }
+    catch (const invalid_argument&)
+    {
+      // Only the pattern database heuristics do not support puzzles of up to 3x3
+      CHECK(name.find("pdb") != string::npos);
+    }
+  }
+
+  // The runtime-sized solver, used beyond 7x7, finds the same depths
+  for (int heuristic = 1; heuristic <= 5; ++heuristic)
+  {
+    DynamicPuzzleSolver<64> solver(PuzzleState(board), dim, dim);
+    vector<PuzzleState> path = solver.solve(heuristic, false);
+    CHECK(isValidSolution(board, path, dim));
+    CHECK(path.size() == exact.size());
+  }
+}
+
+TEST(heuristicsSolve2x2PuzzlesOptimally)
+{
+  mt19937 rng(21);
+  for (int i = 0; i < 10; ++i)
+    checkAgainstExact(scrambledBoard(2, 1 + rng() % 12, rng), 2);
+}
+
+TEST(heuristicsSolve8PuzzlesOptimally)
+{
+  mt19937 rng(21);
+  for (int i = 0; i < 25; ++i)
+    checkAgainstExact(scrambledBoard(3, 10 + rng() % 60, rng), 3);
+}
+
+// No table of exact distances fits the 15-puzzle, so the informed heuristics are
+// checked against each other. The pattern database heuristics are only checked if
+// their databases have been built, in the directory the solver would use
+TEST(informedHeuristicsAgreeOn15Puzzles)
+{
+  if (const char* pdbDirectory = getenv("NPUZZLE_PDB_DIR"))
+    AdditivePatternDatabase::setDirectory(pdbDirectory);
+
+  mt19937 rng(21);
+  bool skipped = false;  // true if some databases are missing
+  for (int i = 0; i < 8; ++i)
+  {
+    vector<int> board = scrambledBoard(4, 40, rng);
+    NPuzzle reference(board);
+    vector<PuzzleState> expected = reference.solve("linear-conflict");
+    CHECK(isValidSolution(board, expected, 4));
+
+    for (size_t n = 4; n <= HEURISTIC_NAMES.size(); ++n)
+    {
+      const string& name = HEURISTIC_NAMES[n - 1];
+      if (name == "exact")
+        continue;
+
+      NPuzzle puzzle(board);
+      try
+      {
+        vector<PuzzleState> path = puzzle.solve(name);
+        CHECK(isValidSolution(board, path, 4));
+        CHECK(path.size() == expected.size());
+      }
+      catch (const runtime_error&)
+      {
+        skipped = true;
+      }
+    }
+  }
+
+  if (skipped)
+    cout << "  (pattern databases not found; build them with pdbgen to test them)" << endl;
+}
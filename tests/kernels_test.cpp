@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+#include "boardkernels.h"
+#include "check.h"
+using namespace std;
+
+// Returns random boards of a Rows x Cols puzzle, a quarter of them only a few swaps
+// away from the goal so that most of their tiles are in place
+template <int Rows, int Cols>
+static vector<vector<uint8_t>> randomBoards(int count, mt19937& rng)
+{
+  constexpr int LEN = Rows * Cols;
+  vector<vector<uint8_t>> boards(count, vector<uint8_t>(LEN));
+  for (vector<uint8_t>& board : boards)
+  {
+    for (int i = 0; i < LEN; ++i)
+      board[i] = (i + 1) % LEN;
+    if (rng() % 4 == 0)
+    {
+      for (int k = 0; k < 3; ++k)
+        swap(board[rng() % LEN], board[rng() % LEN]);
+    }
+    else
+    {
+      shuffle(board.begin(), board.end(), rng);
+    }
+  }
+  return boards;
+}
+
+// Checks every kernel the processor supports against loops over the squares
+template <int Rows, int Cols>
+static void checkKernels()
+{
+  mt19937 rng(23);
+
+  for (const vector<uint8_t>& board : randomBoards<Rows, Cols>(2000, rng))
+  {
+    const uint8_t* squares = board.data();
+    int misplaced = 0;
+    int manhattan = 0;
+    for (int i = 0; i < Rows * Cols; ++i)
+    {
+      int tile = squares[i];
+      if (tile == 0)
+        continue;
+      misplaced += tile != i + 1;
+      manhattan += abs(i / Cols - (tile - 1) / Cols) + abs(i % Cols - (tile - 1) % Cols);
+    }
+
+    CHECK(misplacedTilesScalar<Rows, Cols>(squares) == misplaced);
+    CHECK(manhattanDistanceScalar<Rows, Cols>(squares) == manhattan);
+    CHECK(misplacedTiles<Rows, Cols>(squares) == misplaced);
+    CHECK(manhattanDistance<Rows, Cols>(squares) == manhattan);
+#ifdef BOARDKERNELS_X86
+    if (simdLevel() >= SimdLevel::SSE2)
+    {
+      CHECK(misplacedTilesSse2<Rows, Cols>(squares) == misplaced);
+      CHECK(manhattanDistanceSse2<Rows, Cols>(squares) == manhattan);
+    }
+    if (simdLevel() >= SimdLevel::AVX2)
+    {
+      CHECK(misplacedTilesAvx2<Rows, Cols>(squares) == misplaced);
+      CHECK(manhattanDistanceAvx2<Rows, Cols>(squares) == manhattan);
+    }
+#endif
+  }
+}
+
+TEST(vectorKernelsMatchScalarLoopsOn5x5)
+{
+  checkKernels<5, 5>();
+}
+
+TEST(vectorKernelsMatchScalarLoopsOn6x6)
+{
+  checkKernels<6, 6>();
+}
+
+TEST(vectorKernelsMatchScalarLoopsOn7x7)
+{
+  checkKernels<7, 7>();
+}
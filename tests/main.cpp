@@ -0,0 +1,17 @@
+#include <iostream>
+#include "check.h"
+using namespace std;
+
+// Runs every registered test and returns 1 if any of their checks failed
+int main()
+{
+  for (const TestCase& test : testCases())
+  {
+    int failedBefore = failedChecks();
+    test.run();
+    cout << (failedChecks() == failedBefore ? "PASS " : "FAIL ") << test.name << endl;
+  }
+
+  cout << testCases().size() << " tests, " << failedChecks() << " failed checks" << endl;
+  return failedChecks() == 0 ? 0 : 1;
+}
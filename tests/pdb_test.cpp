@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "check.h"
+#include "pdb.h"
+using namespace std;
+
+// Returns a path for a database file in the system's temporary directory
+static string temporaryPath(const string& name)
+{
+  return (filesystem::temp_directory_path() / name).string();
+}
+
+// Returns true if loading the file throws runtime_error
+static bool loadFails(const string& path, bool verify)
+{
+  try
+  {
+    PatternDatabase::load(path, verify);
+  }
+  catch (const runtime_error&)
+  {
+    return true;
+  }
+  return false;
+}
+
+// Replaces the byte at the given offset from the start of a file, or from its end if
+// the offset is negative, with its complement
+static void flipByte(const string& path, long offset)
+{
+  fstream file(path, ios::in | ios::out | ios::binary);
+  file.seekg(offset, offset < 0 ? ios::end : ios::beg);
+  char byte = file.get();
+  file.seekp(offset, offset < 0 ? ios::end : ios::beg);
+  file.put(~byte);
+}
+
+// A database written by save and read back by load gives the same cost for every
+// placement of its tiles
+TEST(savedDatabasesLoadWithTheSameCosts)
+{
+  string path = temporaryPath("npuzzle_test_round_trip.pdb");
+  PatternDatabase built = PatternDatabase::build(3, 3, {1, 2, 3, 4});
+  built.save(path);
+
+  {
+    PatternDatabase loaded = PatternDatabase::load(path);
+    CHECK(loaded.rows() == 3 && loaded.cols() == 3);
+    CHECK(loaded.tiles() == built.tiles());
+    CHECK(loaded.size() == built.size());
+    CHECK(loaded.memoryUsage() == built.memoryUsage());
+
+    vector<int> squares = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    mt19937 rng(15);
+    int squareOf[16];  // square of every number
+    for (int i = 0; i < 5000; ++i)
+    {
+      shuffle(squares.begin(), squares.end(), rng);
+      for (int number = 0; number < 9; ++number)
+        squareOf[number] = squares[number];
+      CHECK(loaded.cost(squareOf) == built.cost(squareOf));
+      CHECK(built.cost(squareOf) != PatternDatabase::UNKNOWN);
+    }
+  }
+
+  remove(path.c_str());
+}
+
+// A changed entry is found by the checksum, and a changed header or size is found
+// even without it
+TEST(damagedDatabasesAreRejected)
+{
+  string path = temporaryPath("npuzzle_test_damaged.pdb");
+  PatternDatabase built = PatternDatabase::build(3, 3, {1, 2, 3, 4});
+
+  built.save(path);
+  CHECK(!loadFails(path, true));
+  flipByte(path, -1);
+  CHECK(loadFails(path, true));
+  CHECK(!loadFails(path, false));
+
+  built.save(path);
+  flipByte(path, 0);
+  CHECK(loadFails(path, false));
+
+  built.save(path);
+  filesystem::resize_file(path, filesystem::file_size(path) - 1);
+  CHECK(loadFails(path, false));
+
+  remove(path.c_str());
+  CHECK(loadFails(path, false));
+}
+
+// Saving over a database file that a solver has mapped replaces the file without
+// changing the entries the solver reads
+TEST(savingOverALoadedDatabaseKeepsItsEntries)
+{
+  string path = temporaryPath("npuzzle_test_replaced.pdb");
+  PatternDatabase first = PatternDatabase::build(3, 3, {1, 2, 3, 4});
+  PatternDatabase second = PatternDatabase::build(3, 3, {5, 6, 7, 8});
+  first.save(path);
+
+  {
+    PatternDatabase loaded = PatternDatabase::load(path);
+    second.save(path);
+    CHECK(!filesystem::exists(path + ".tmp"));
+    CHECK(PatternDatabase::load(path).tiles() == second.tiles());
+
+    vector<int> squares = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    mt19937 rng(17);
+    int squareOf[16];  // square of every number
+    for (int i = 0; i < 1000; ++i)
+    {
+      shuffle(squares.begin(), squares.end(), rng);
+      for (int number = 0; number < 9; ++number)
+        squareOf[number] = squares[number];
+      CHECK(loaded.cost(squareOf) == first.cost(squareOf));
+    }
+  }
+
+  remove(path.c_str());
+}
+
+// The databases of a partition are loaded again when the directory or the
+// verification setting changes, instead of coming from the previous directory
+TEST(databasesAreCachedPerDirectoryAndVerification)
+{
+  string sound = temporaryPath("npuzzle_test_sound");
+  string damaged = temporaryPath("npuzzle_test_damaged");
+  vector<vector<int>> partition = {{1, 2, 3, 4}};
+  string name = PatternDatabase::fileName(3, 3, partition[0]);
+  PatternDatabase built = PatternDatabase::build(3, 3, partition[0]);
+  filesystem::create_directories(sound);
+  filesystem::create_directories(damaged);
+  built.save(sound + "/" + name);
+  built.save(damaged + "/" + name);
+  flipByte(damaged + "/" + name, -1);
+
+  AdditivePatternDatabase::setDirectory(sound);
+  AdditivePatternDatabase::get(3, 3, partition);
+
+  bool thrown = false;
+  AdditivePatternDatabase::setDirectory(damaged);
+  try
+  {
+    AdditivePatternDatabase::get(3, 3, partition);
+  }
+  catch (const runtime_error&)
+  {
+    thrown = true;
+  }
+  CHECK(thrown);
+
+  AdditivePatternDatabase::setVerification(false);
+  const AdditivePatternDatabase& unverified = AdditivePatternDatabase::get(3, 3, partition);
+  CHECK(unverified.memoryUsage() == built.memoryUsage());
+
+  AdditivePatternDatabase::setVerification(true);
+  AdditivePatternDatabase::setDirectory("pdb");
+  filesystem::remove_all(sound);
+  filesystem::remove_all(damaged);
+}
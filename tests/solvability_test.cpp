@@ -0,0 +1,80 @@
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "check.h"
+#include "npuzzle.h"
+using namespace std;
+
+// Returns the goal board of a dim x dim puzzle with the blank moved back along the
+// last row by shift squares, which keeps it solvable
+static vector<int> solvableBoard(int dim, int shift)
+{
+  vector<int> board(dim * dim);
+  for (int i = 0; i < dim * dim - 1; ++i)
+    board[i] = i + 1;
+  for (int i = dim * dim - 1; i > dim * dim - 1 - shift; --i)
+    swap(board[i], board[i - 1]);
+  return board;
+}
+
+// Swapping two tiles changes the parity of the permutation, so no sequence of moves
+// can reach the goal
+TEST(unsolvablePuzzlesAreRejected)
+{
+  for (int dim : {2, 3, 4, 5, 8})
+  {
+    vector<int> board = solvableBoard(dim, 1);
+    swap(board[0], board[1]);
+    NPuzzle puzzle(board);
+    CHECK(puzzle.solve("manhattan").empty());
+    CHECK(puzzle.nodesExpanded() == 0);
+  }
+}
+
+TEST(solvablePuzzlesAreSolved)
+{
+  for (int dim : {1, 2, 3, 4, 5, 8})
+  {
+    int shift = dim > 1 ? 1 : 0;
+    NPuzzle puzzle(solvableBoard(dim, shift));
+    CHECK((int)puzzle.solve("manhattan").size() == shift + 1);
+  }
+}
+
+TEST(nonSquarePuzzlesAreRejected)
+{
+  bool thrown = false;
+  try
+  {
+    NPuzzle puzzle({1, 2, 3, 4, 5, 0});
+  }
+  catch (const invalid_argument&)
+  {
+    thrown = true;
+  }
+  CHECK(thrown);
+}
+
+// A repeated or out-of-range number would be packed into the neighboring squares of
+// the board and index past the Zobrist keys
+TEST(nonPermutationsAreRejected)
+{
+  vector<vector<int>> boards = {
+    {1, 2, 3, 4, 5, 6, 7, 7, 0},  // repeated number
+    {1, 2, 3, 4, 5, 6, 7, 9, 0},  // number past the size
+    {1, 2, 3, 4, 5, 6, 7, -8, 0}  // negative number
+  };
+  for (const vector<int>& board : boards)
+  {
+    bool thrown = false;
+    try
+    {
+      NPuzzle puzzle(board);
+    }
+    catch (const invalid_argument&)
+    {
+      thrown = true;
+    }
+    CHECK(thrown);
+  }
+}
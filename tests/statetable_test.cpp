@@ -0,0 +1,76 @@
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+#include "check.h"
+#include "puzzleboard.h"
+#include "statetable.h"
+using namespace std;
+
+using Key = StateKey<PackedBoard>;
+
+// Returns a key whose board is the given number and whose hash is the given one, so
+// that tests can choose which keys collide
+static Key makeKey(uint64_t number, uint64_t hash)
+{
+  PackedBoard board;
+  board.bits = number;
+  return Key(board, hash);
+}
+
+// Keys sharing a home slot near the end of the table wrap around to its start, and
+// erasing one of them must leave the others reachable
+TEST(erasedKeysLeaveCollidingKeysReachable)
+{
+  StateTable<PackedBoard, int> table(0.9f, 16);
+  vector<Key> keys;
+  for (int i = 0; i < 6; ++i)
+    keys.push_back(makeKey(i + 1, 14 + (i % 2)));  // home slots 14 and 15
+  for (int i = 0; i < 6; ++i)
+    table.insert(keys[i], i);
+
+  CHECK(table.erase(keys[0]));
+  CHECK(!table.erase(keys[0]));
+  CHECK(table.find(keys[0]) == nullptr);
+  for (int i = 1; i < 6; ++i)
+    CHECK(table.find(keys[i]) != nullptr && *table.find(keys[i]) == i);
+
+  // Reinserting the erased key stores its new value once
+  table.insert(keys[0], 10);
+  CHECK(table.size() == 6);
+  CHECK(table.find(keys[0]) != nullptr && *table.find(keys[0]) == 10);
+}
+
+// Random inserts, erases and reinserts with many colliding hashes, across several
+// doublings of the table, agree with a map
+TEST(randomUpdatesMatchMap)
+{
+  StateTable<PackedBoard, int> table(0.5f, 16);
+  map<uint64_t, int> expected;  // value of every key present, by board
+  mt19937_64 rng(6);
+
+  for (int step = 0; step < 20000; ++step)
+  {
+    uint64_t number = 1 + rng() % 600;
+    Key key = makeKey(number, number % 37);  // about 16 keys per hash
+    if (rng() % 3 == 0)
+    {
+      CHECK(table.erase(key) == (expected.erase(number) == 1));
+    }
+    else
+    {
+      table.insert(key, step);
+      expected[number] = step;
+    }
+  }
+
+  CHECK(table.size() == expected.size());
+  for (uint64_t number = 1; number <= 600; ++number)
+  {
+    const int* value = table.find(makeKey(number, number % 37));
+    auto found = expected.find(number);
+    CHECK((value == nullptr) == (found == expected.end()));
+    if (value != nullptr && found != expected.end())
+      CHECK(*value == found->second);
+  }
+}
@@ -0,0 +1,188 @@
+#ifndef WALKINGDISTANCE_H
+#define WALKINGDISTANCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+/*********************************************************************
+ *
+ * WALKINGDISTANCE
+ *
+ *--------------------------------------------------------------------
+ * File Contents
+ *   class WalkingDistanceTable: move counts of the Walking Distance
+ *   heuristic for square puzzles
+ *********************************************************************/
+
+/*********************************************************************
+ * WalkingDistanceTable Class
+ *   Holds the Walking Distance tables of a Size x Size puzzle. The
+ *   rows of a board are summarized by a matrix whose entry (r, g) is
+ *   the number of tiles in row r whose goal row is g; a vertical move
+ *   carries one tile into the blank's row from the row above or below
+ *   it, and a horizontal move leaves the matrix unchanged. The table
+ *   holds the least number of vertical moves that turn each reachable
+ *   matrix into the goal's, and the matrix reached by each move. The
+ *   goal is symmetric about the main diagonal, so the columns of a
+ *   board, summarized the same way by goal column, use the same
+ *   table, and the Walking Distance of a board is the sum of its row
+ *   and column costs. Every move changes one of the two by at most
+ *   one, so the heuristic is consistent, and it is at least the
+ *   Manhattan Distance.
+ *
+ *   Matrices are numbered in the order the breadth-first search that
+ *   builds the table reaches them (24,964 for the 15-puzzle), so a
+ *   search node stores two 16-bit numbers and a child's are found by
+ *   a single lookup each, indexed by the matrix, the direction the
+ *   blank moves and the goal line of the moved tile. The table of
+ *   each size is built once per process, the first time it is used.
+ *--------------------------------------------------------------------
+ * PRE-CONDITION
+ *   Size must be from 2 to 4, so that a matrix fits in 48 bits with
+ *   3 bits per entry.
+ *********************************************************************/
+template <int Size>
+class WalkingDistanceTable
+{
+  static_assert(Size >= 2 && Size <= 4, "Walking Distance tables support 2x2 to 4x4 puzzles");
+
+  public:
+    static constexpr uint16_t NONE = 0xFFFF;  // matrix reached by an impossible move
+
+    // Returns the table of this size, building it on first use
+    static const WalkingDistanceTable& get()
+    {
+      static const WalkingDistanceTable table;
+      return table;
+    }
+
+    // Returns the number of the matrix of the given counts of tiles by line and
+    // goal line, where the blank's line holds one tile less than the others
+    uint16_t index(const int counts[Size][Size]) const
+    {
+      return ids.at(encode(counts));
+    }
+
+    // Returns the matrix reached when the blank leaves its line toward the previous
+    // line (direction 0) or the next one (direction 1), moving a tile of goal line g
+    uint16_t next(uint16_t matrix, int direction, int g) const
+    {
+      return moves[matrix].to[direction][g];
+    }
+
+    // Returns the least number of moves across lines needed to reach the goal
+    int cost(uint16_t matrix) const
+    {
+      return costs[matrix];
+    }
+
+    // Returns the number of matrices
+    size_t size() const { return costs.size(); }
+
+  private:
+    struct Move
+    {
+      uint16_t to[2][Size];  // matrix reached by each direction and goal line
+    };
+
+    // Builds the tables by a breadth-first search from the goal matrix
+    WalkingDistanceTable()
+    {
+      int counts[Size][Size] = {};  // tiles of each line by goal line
+      for (int line = 0; line < Size; ++line)
+        counts[line][line] = line < Size - 1 ? Size : Size - 1;
+
+      std::deque<uint64_t> queue;  // codes of matrices to expand
+      add(encode(counts), 0);
+      queue.push_back(encode(counts));
+
+      while (!queue.empty())
+      {
+        uint64_t code = queue.front();
+        queue.pop_front();
+        uint16_t matrix = ids[code];
+        decode(code, counts);
+
+        // The blank's line holds one tile less than the others
+        int blankLine = 0;
+        for (int line = 0; line < Size; ++line)
+        {
+          int tiles = 0;
+          for (int g = 0; g < Size; ++g)
+            tiles += counts[line][g];
+          if (tiles == Size - 1)
+            blankLine = line;
+        }
+
+        for (int direction = 0; direction < 2; ++direction)
+        {
+          int from = blankLine + (direction == 0 ? -1 : 1);  // line the tile leaves
+          for (int g = 0; g < Size; ++g)
+          {
+            if (from < 0 || from >= Size || counts[from][g] == 0)
+              continue;
+
+            counts[from][g]--;
+            counts[blankLine][g]++;
+            uint64_t nextCode = encode(counts);
+            if (ids.find(nextCode) == ids.end())
+            {
+              add(nextCode, costs[matrix] + 1);
+              queue.push_back(nextCode);
+            }
+            moves[matrix].to[direction][g] = ids[nextCode];
+            counts[blankLine][g]--;
+            counts[from][g]++;
+          }
+        }
+      }
+    }
+
+    // Numbers a new matrix with the given cost
+    void add(uint64_t code, int cost)
+    {
+      ids[code] = costs.size();
+      costs.push_back(cost);
+      Move none;
+      for (int direction = 0; direction < 2; ++direction)
+      {
+        for (int g = 0; g < Size; ++g)
+          none.to[direction][g] = NONE;
+      }
+      moves.push_back(none);
+    }
+
+    // Packs a matrix into 3 bits per entry
+    static uint64_t encode(const int counts[Size][Size])
+    {
+      uint64_t code = 0;
+      for (int line = 0; line < Size; ++line)
+      {
+        for (int g = 0; g < Size; ++g)
+          code = (code << 3) | counts[line][g];
+      }
+      return code;
+    }
+
+    // Unpacks a matrix packed by encode
+    static void decode(uint64_t code, int counts[Size][Size])
+    {
+      for (int line = Size - 1; line >= 0; --line)
+      {
+        for (int g = Size - 1; g >= 0; --g)
+        {
+          counts[line][g] = code & 7;
+          code >>= 3;
+        }
+      }
+    }
+
+    std::unordered_map<uint64_t, uint16_t> ids;  // number of every matrix, by code
+    std::vector<uint8_t> costs;                  // cost of every matrix
+    std::vector<Move> moves;                     // matrices reached from every matrix
+};
+
+#endif // WALKINGDISTANCE_H